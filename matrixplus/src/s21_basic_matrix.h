@@ -0,0 +1,664 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_BASIC_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_BASIC_MATRIX_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_lu.h"
+#include "s21_matrix_simd.h"
+#include "s21_memory_resource.h"
+#include "s21_thread_pool.h"
+
+// Largest difference EqMatrix and the singularity checks accept between two
+// elements of type T. Integers compare exactly; specialize to tune a type.
+template <typename T>
+struct S21Tolerance {
+  static constexpr T kValue = T();
+};
+
+template <>
+struct S21Tolerance<double> {
+  static constexpr double kValue = 1e-07;
+};
+
+template <>
+struct S21Tolerance<float> {
+  static constexpr float kValue = 1e-05f;
+};
+
+template <>
+struct S21Tolerance<long double> {
+  static constexpr long double kValue = 1e-07L;
+};
+
+// Complex numbers are compared by the modulus of their difference.
+template <typename U>
+struct S21Tolerance<std::complex<U>> {
+  static constexpr U kValue = S21Tolerance<U>::kValue;
+};
+
+template <typename T>
+bool S21NearlyEqual(const T &a, const T &b) {
+  if constexpr (std::is_integral_v<T>) {
+    return a == b;
+  } else {
+    return std::abs(a - b) <= S21Tolerance<T>::kValue;
+  }
+}
+
+// Element types that go through the packed GEMM, the SIMD kernels and the
+// blocked LU shared with S21Matrix.
+template <typename T>
+struct S21HasKernels : std::is_same<T, float> {};
+
+// Matrix over an arbitrary element type: float, integers, std::complex. The
+// double instantiation is specialized in s21_matrix_oop.h with expression
+// templates on top of the tuned kernels. float runs the same kernels in
+// single precision; the other types use plain loops, integer types computing
+// Determinant and CalcComplements exactly with fraction-free elimination.
+template <typename T>
+class S21BasicMatrix {
+ public:
+  S21BasicMatrix();
+  S21BasicMatrix(int rows, int cols);
+  S21BasicMatrix(const S21BasicMatrix &other);
+  S21BasicMatrix(S21BasicMatrix &&other) noexcept;
+  ~S21BasicMatrix() = default;
+
+  bool EqMatrix(const S21BasicMatrix &other) const noexcept;
+  void SumMatrix(const S21BasicMatrix &other);
+  void SubMatrix(const S21BasicMatrix &other);
+  void MulNumber(const T num);
+  void MulMatrix(const S21BasicMatrix &other);
+  S21BasicMatrix Transpose() const;
+  S21BasicMatrix CalcComplements() const;
+  T Determinant() const;
+  // For integer types only unimodular matrices (determinant +-1) have an
+  // inverse; others throw std::invalid_argument.
+  S21BasicMatrix InverseMatrix() const;
+
+  S21BasicMatrix &operator=(const S21BasicMatrix &other);
+  S21BasicMatrix &operator=(S21BasicMatrix &&other);
+  bool operator==(const S21BasicMatrix &other) const;
+  S21BasicMatrix &operator+=(const S21BasicMatrix &other);
+  S21BasicMatrix &operator-=(const S21BasicMatrix &other);
+  S21BasicMatrix &operator*=(const S21BasicMatrix &other);
+  S21BasicMatrix &operator*=(const T num);
+  T &operator()(const int i, const int j);
+  T operator()(int i, int j) const;
+
+  void SetRows(const int rows);
+  void SetCols(const int cols);
+  int GetRows() const;
+  int GetCols() const;
+
+  friend S21BasicMatrix operator+(const S21BasicMatrix &lhs,
+                                  const S21BasicMatrix &rhs) {
+    S21BasicMatrix res(lhs);
+    res.SumMatrix(rhs);
+    return res;
+  }
+
+  friend S21BasicMatrix operator-(const S21BasicMatrix &lhs,
+                                  const S21BasicMatrix &rhs) {
+    S21BasicMatrix res(lhs);
+    res.SubMatrix(rhs);
+    return res;
+  }
+
+  friend S21BasicMatrix operator*(const S21BasicMatrix &lhs,
+                                  const S21BasicMatrix &rhs) {
+    S21BasicMatrix res(lhs);
+    res.MulMatrix(rhs);
+    return res;
+  }
+
+  friend S21BasicMatrix operator*(const S21BasicMatrix &matrix, const T num) {
+    S21BasicMatrix res(matrix);
+    res.MulNumber(num);
+    return res;
+  }
+
+  friend S21BasicMatrix operator*(const T num, const S21BasicMatrix &matrix) {
+    return matrix * num;
+  }
+
+ private:
+  int rows_, cols_;
+  std::pmr::vector<T> matrix_;
+
+  T *Row(int i) noexcept {
+    return matrix_.data() + static_cast<std::ptrdiff_t>(i) * cols_;
+  }
+  const T *Row(int i) const noexcept {
+    return matrix_.data() + static_cast<std::ptrdiff_t>(i) * cols_;
+  }
+  long Size() const noexcept { return static_cast<long>(rows_) * cols_; }
+  bool CheckMatrix(const S21BasicMatrix &other) const;
+  void CheckSquare() const;
+  S21BasicMatrix MinorMatrix(const int x, const int y) const;
+  // PA = LU as S21Matrix::FactorLu: false if a pivot is not above the
+  // tolerance relative to the largest entry. Kernel types only.
+  bool FactorLu(S21BasicMatrix &lu, std::vector<int> &perm, int &sign) const;
+  // Complements of a regular integer matrix by fraction-free Gauss-Jordan
+  // elimination of [A | I]; false, with res untouched, if A is singular.
+  bool FractionFreeComplements(S21BasicMatrix &res) const;
+};
+
+template <typename T>
+S21BasicMatrix<T>::S21BasicMatrix()
+    : rows_(0), cols_(0), matrix_(S21CurrentMemoryResource()) {}
+
+template <typename T>
+S21BasicMatrix<T>::S21BasicMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols), matrix_(S21CurrentMemoryResource()) {
+  if (rows_ > 0 && cols_ > 0) {
+    matrix_.resize(static_cast<std::size_t>(rows_) * cols_);
+  } else {
+    throw std::out_of_range("Invalid matrix size");
+  }
+}
+
+template <typename T>
+S21BasicMatrix<T>::S21BasicMatrix(const S21BasicMatrix &other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      matrix_(other.matrix_, S21CurrentMemoryResource()) {}
+
+template <typename T>
+S21BasicMatrix<T>::S21BasicMatrix(S21BasicMatrix &&other) noexcept
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      matrix_(std::move(other.matrix_)) {
+  other.rows_ = 0;
+  other.cols_ = 0;
+  other.matrix_.clear();
+}
+
+template <typename T>
+bool S21BasicMatrix<T>::EqMatrix(const S21BasicMatrix &other) const noexcept {
+  if (CheckMatrix(other)) return false;
+  if constexpr (S21HasKernels<T>::value) {
+    const s21::BasicSimdKernels<T> &simd = s21::Simd<T>();
+    for (int i = 0; i < rows_; i++) {
+      if (!simd.equal(Row(i), other.Row(i), cols_, S21Tolerance<T>::kValue)) {
+        return false;
+      }
+    }
+  } else {
+    for (std::size_t k = 0; k < matrix_.size(); k++) {
+      if (!S21NearlyEqual(matrix_[k], other.matrix_[k])) return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void S21BasicMatrix<T>::SumMatrix(const S21BasicMatrix &other) {
+  if (CheckMatrix(other)) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  if constexpr (S21HasKernels<T>::value) {
+    const s21::BasicSimdKernels<T> &simd = s21::Simd<T>();
+    s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        simd.add(Row(i), other.Row(i), cols_);
+      }
+    });
+  } else {
+    for (std::size_t k = 0; k < matrix_.size(); k++) {
+      matrix_[k] += other.matrix_[k];
+    }
+  }
+}
+
+template <typename T>
+void S21BasicMatrix<T>::SubMatrix(const S21BasicMatrix &other) {
+  if (CheckMatrix(other)) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  if constexpr (S21HasKernels<T>::value) {
+    const s21::BasicSimdKernels<T> &simd = s21::Simd<T>();
+    s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        simd.sub(Row(i), other.Row(i), cols_);
+      }
+    });
+  } else {
+    for (std::size_t k = 0; k < matrix_.size(); k++) {
+      matrix_[k] -= other.matrix_[k];
+    }
+  }
+}
+
+template <typename T>
+void S21BasicMatrix<T>::MulNumber(const T num) {
+  if constexpr (S21HasKernels<T>::value) {
+    const s21::BasicSimdKernels<T> &simd = s21::Simd<T>();
+    s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        simd.scale(Row(i), num, cols_);
+      }
+    });
+  } else {
+    for (T &value : matrix_) {
+      value *= num;
+    }
+  }
+}
+
+template <typename T>
+void S21BasicMatrix<T>::MulMatrix(const S21BasicMatrix &other) {
+  if (cols_ != other.rows_ || matrix_.empty() || other.matrix_.empty()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21BasicMatrix res(rows_, other.cols_);
+  if constexpr (S21HasKernels<T>::value) {
+    s21::Gemm(rows_, other.cols_, cols_, T(1), Row(0), cols_, 1, other.Row(0),
+              other.cols_, 1, T(0), res.Row(0), res.cols_);
+  } else {
+    for (int i = 0; i < rows_; i++) {
+      T *dst = res.Row(i);
+      for (int k = 0; k < cols_; k++) {
+        const T a = Row(i)[k];
+        const T *b = other.Row(k);
+        for (int j = 0; j < other.cols_; j++) {
+          dst[j] += a * b[j];
+        }
+      }
+    }
+  }
+  *this = std::move(res);
+}
+
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::Transpose() const {
+  S21BasicMatrix res(cols_, rows_);
+  if constexpr (S21HasKernels<T>::value) {
+    s21::Transpose(Row(0), cols_, res.Row(0), res.cols_, rows_, cols_);
+  } else {
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) {
+        res.Row(j)[i] = Row(i)[j];
+      }
+    }
+  }
+  return res;
+}
+
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::MinorMatrix(const int x,
+                                                 const int y) const {
+  S21BasicMatrix res(rows_ - 1, cols_ - 1);
+  for (int i = 0, min_i = 0; i < rows_; i++) {
+    if (i == x) continue;
+    for (int j = 0, min_j = 0; j < cols_; j++) {
+      if (j == y) continue;
+      res.Row(min_i)[min_j++] = Row(i)[j];
+    }
+    min_i++;
+  }
+  return res;
+}
+
+// One O(n^3) elimination: fraction-free Gauss-Jordan for integers, the
+// blocked LU for the kernel types as in S21Matrix, and s21::Adjugate for the
+// others and for singular kernel-type matrices. Only a singular integer
+// matrix computes its n^2 cofactors one by one, with a Bareiss determinant
+// of each minor: O(n^5) operations and n^2 allocations, but exact.
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::CalcComplements() const {
+  CheckSquare();
+  const int n = rows_;
+  S21BasicMatrix res(n, n);
+  if constexpr (std::is_integral_v<T>) {
+    if (FractionFreeComplements(res)) return res;
+    if (n == 1) {
+      res.Row(0)[0] = T(1);
+      return res;
+    }
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        const T minor = MinorMatrix(i, j).Determinant();
+        res.Row(i)[j] = (i + j) % 2 == 0 ? minor : -minor;
+      }
+    }
+    return res;
+  } else {
+    bool regular = false;
+    if constexpr (S21HasKernels<T>::value) {
+      S21BasicMatrix lu;
+      std::vector<int> perm;
+      int sign = 0;
+      regular = FactorLu(lu, perm, sign);
+      if (regular) {
+        T determinant = static_cast<T>(sign);
+        for (int i = 0; i < n; i++) {
+          res.Row(i)[i] = T(1);
+          determinant *= lu.Row(i)[i];
+        }
+        s21::LuSolve(lu.Row(0), n, n, perm.data(), res.Row(0), n, n);
+        res.MulNumber(determinant);
+      }
+    }
+    if (!regular) {
+      S21BasicMatrix a(*this);
+      s21::Adjugate(a.Row(0), n, n, res.Row(0), n);
+    }
+    // res holds adj(A), the transpose of the complements.
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) {
+        std::swap(res.Row(i)[j], res.Row(j)[i]);
+      }
+    }
+    return res;
+  }
+}
+
+// Integers use Bareiss elimination, where every division is exact; other
+// types use Gaussian elimination with partial pivoting, blocked for the
+// kernel types.
+template <typename T>
+T S21BasicMatrix<T>::Determinant() const {
+  CheckSquare();
+  std::vector<T> a(matrix_.begin(), matrix_.end());
+  const int n = rows_;
+  if constexpr (S21HasKernels<T>::value) {
+    T res = static_cast<T>(s21::LuFactor(a.data(), n, n, nullptr));
+    for (int k = 0; k < n && res != T(0); k++) {
+      res *= a[static_cast<std::size_t>(k) * n + k];
+    }
+    return res;
+  }
+  T sign = T(1);
+  T previous = T(1);
+  for (int k = 0; k < n; k++) {
+    int pivot = k;
+    if constexpr (std::is_integral_v<T>) {
+      while (pivot < n && a[pivot * n + k] == T(0)) pivot++;
+      if (pivot == n) return T(0);
+    } else {
+      for (int i = k + 1; i < n; i++) {
+        if (std::abs(a[i * n + k]) > std::abs(a[pivot * n + k])) pivot = i;
+      }
+      if (a[pivot * n + k] == T(0)) return T(0);
+    }
+    if (pivot != k) {
+      std::swap_ranges(a.begin() + k * n, a.begin() + (k + 1) * n,
+                       a.begin() + pivot * n);
+      sign = -sign;
+    }
+    const T diag = a[k * n + k];
+    for (int i = k + 1; i < n; i++) {
+      if constexpr (std::is_integral_v<T>) {
+        for (int j = k + 1; j < n; j++) {
+          a[i * n + j] =
+              (a[i * n + j] * diag - a[i * n + k] * a[k * n + j]) / previous;
+        }
+      } else {
+        const T l = a[i * n + k] / diag;
+        for (int j = k + 1; j < n; j++) {
+          a[i * n + j] -= l * a[k * n + j];
+        }
+      }
+    }
+    previous = diag;
+  }
+  if constexpr (std::is_integral_v<T>) {
+    return sign * a[n * n - 1];
+  } else {
+    T res = sign;
+    for (int k = 0; k < n; k++) {
+      res *= a[k * n + k];
+    }
+    return res;
+  }
+}
+
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::InverseMatrix() const {
+  CheckSquare();
+  if constexpr (std::is_integral_v<T>) {
+    const T determinant = Determinant();
+    if (determinant != T(1) && determinant != T(-1)) {
+      throw std::invalid_argument("Matrix has no integer inverse");
+    }
+    S21BasicMatrix res = CalcComplements().Transpose();
+    res.MulNumber(determinant);
+    return res;
+  } else if constexpr (S21HasKernels<T>::value) {
+    S21BasicMatrix lu;
+    std::vector<int> perm;
+    int sign = 0;
+    if (!FactorLu(lu, perm, sign)) {
+      throw std::invalid_argument("Matrix determinant is 0");
+    }
+    S21BasicMatrix res(rows_, rows_);
+    for (int i = 0; i < rows_; i++) {
+      res.Row(i)[i] = T(1);
+    }
+    s21::LuSolve(lu.Row(0), rows_, rows_, perm.data(), res.Row(0), rows_,
+                 rows_);
+    return res;
+  } else {
+    // Gauss-Jordan elimination on [A | I].
+    const int n = rows_;
+    S21BasicMatrix a(*this);
+    S21BasicMatrix res(n, n);
+    auto scale = decltype(std::abs(T()))();
+    for (const T &value : matrix_) {
+      scale = std::max(scale, std::abs(value));
+    }
+    for (int i = 0; i < n; i++) {
+      res.Row(i)[i] = T(1);
+    }
+    for (int k = 0; k < n; k++) {
+      int pivot = k;
+      for (int i = k + 1; i < n; i++) {
+        if (std::abs(a.Row(i)[k]) > std::abs(a.Row(pivot)[k])) pivot = i;
+      }
+      if (!(std::abs(a.Row(pivot)[k]) > S21Tolerance<T>::kValue * scale)) {
+        throw std::invalid_argument("Matrix determinant is 0");
+      }
+      std::swap_ranges(a.Row(k), a.Row(k) + n, a.Row(pivot));
+      std::swap_ranges(res.Row(k), res.Row(k) + n, res.Row(pivot));
+      const T inv_pivot = T(1) / a.Row(k)[k];
+      for (int j = 0; j < n; j++) {
+        a.Row(k)[j] *= inv_pivot;
+        res.Row(k)[j] *= inv_pivot;
+      }
+      for (int i = 0; i < n; i++) {
+        const T l = a.Row(i)[k];
+        if (i == k || l == T(0)) continue;
+        for (int j = 0; j < n; j++) {
+          a.Row(i)[j] -= l * a.Row(k)[j];
+          res.Row(i)[j] -= l * res.Row(k)[j];
+        }
+      }
+    }
+    return res;
+  }
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator=(const S21BasicMatrix &other) {
+  if (this != &other) {
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    matrix_.assign(other.matrix_.begin(), other.matrix_.end());
+  }
+  return *this;
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator=(S21BasicMatrix &&other) {
+  if (this != &other) {
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    matrix_ = std::move(other.matrix_);
+    other.rows_ = 0;
+    other.cols_ = 0;
+    other.matrix_.clear();
+  }
+  return *this;
+}
+
+template <typename T>
+bool S21BasicMatrix<T>::operator==(const S21BasicMatrix &other) const {
+  return EqMatrix(other);
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator+=(const S21BasicMatrix &other) {
+  SumMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator-=(const S21BasicMatrix &other) {
+  SubMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator*=(const S21BasicMatrix &other) {
+  MulMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21BasicMatrix<T> &S21BasicMatrix<T>::operator*=(const T num) {
+  MulNumber(num);
+  return *this;
+}
+
+template <typename T>
+T &S21BasicMatrix<T>::operator()(const int i, const int j) {
+  if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
+    throw std::out_of_range("Index outside the matrix");
+  return Row(i)[j];
+}
+
+template <typename T>
+T S21BasicMatrix<T>::operator()(const int i, const int j) const {
+  if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
+    throw std::out_of_range("Index outside the matrix");
+  return Row(i)[j];
+}
+
+template <typename T>
+void S21BasicMatrix<T>::SetRows(const int rows) {
+  if (rows < 0) {
+    throw std::out_of_range("Invalid matrix size");
+  }
+  S21BasicMatrix temp_matrix(rows, cols_);
+  std::copy(Row(0), Row(std::min(rows, rows_)), temp_matrix.Row(0));
+  *this = std::move(temp_matrix);
+}
+
+template <typename T>
+void S21BasicMatrix<T>::SetCols(const int cols) {
+  if (cols < 0) {
+    throw std::out_of_range("Invalid matrix size");
+  }
+  S21BasicMatrix temp_matrix(rows_, cols);
+  for (int i = 0; i < rows_; i++) {
+    std::copy(Row(i), Row(i) + std::min(cols, cols_), temp_matrix.Row(i));
+  }
+  *this = std::move(temp_matrix);
+}
+
+template <typename T>
+int S21BasicMatrix<T>::GetRows() const {
+  return rows_;
+}
+
+template <typename T>
+int S21BasicMatrix<T>::GetCols() const {
+  return cols_;
+}
+
+template <typename T>
+bool S21BasicMatrix<T>::FactorLu(S21BasicMatrix &lu, std::vector<int> &perm,
+                                 int &sign) const {
+  lu = *this;
+  perm.resize(rows_);
+  T scale = T(0);
+  for (const T &value : matrix_) {
+    scale = std::max(scale, std::abs(value));
+  }
+  sign = s21::LuFactor(lu.Row(0), rows_, rows_, perm.data());
+  bool regular = sign != 0;
+  for (int i = 0; i < rows_ && regular; i++) {
+    regular = std::abs(lu.Row(i)[i]) > S21Tolerance<T>::kValue * scale;
+  }
+  return regular;
+}
+
+// Every entry of [A | I] after step k is a minor of order k + 1 of the
+// initial one, so each division by the previous pivot is exact. The result
+// is [d I | d A^-1] with d = +-det(A), and adj(A) = det(A) A^-1.
+template <typename T>
+bool S21BasicMatrix<T>::FractionFreeComplements(S21BasicMatrix &res) const {
+  const int n = rows_, width = 2 * n;
+  S21BasicMatrix a(n, width);
+  for (int i = 0; i < n; i++) {
+    std::copy(Row(i), Row(i) + n, a.Row(i));
+    a.Row(i)[n + i] = T(1);
+  }
+  T previous = T(1);
+  bool negate = false;
+  for (int k = 0; k < n; k++) {
+    int pivot = k;
+    while (pivot < n && a.Row(pivot)[k] == T(0)) pivot++;
+    if (pivot == n) return false;
+    if (pivot != k) {
+      std::swap_ranges(a.Row(k), a.Row(k) + width, a.Row(pivot));
+      negate = !negate;
+    }
+    const T *pivot_row = a.Row(k);
+    const T diag = pivot_row[k];
+    for (int i = 0; i < n; i++) {
+      if (i == k) continue;
+      T *row = a.Row(i);
+      const T factor = row[k];
+      for (int j = 0; j < width; j++) {
+        row[j] = (diag * row[j] - factor * pivot_row[j]) / previous;
+      }
+    }
+    previous = diag;
+  }
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      const T value = a.Row(i)[n + j];
+      res.Row(j)[i] = negate ? -value : value;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+bool S21BasicMatrix<T>::CheckMatrix(const S21BasicMatrix &other) const {
+  return cols_ != other.cols_ || rows_ != other.rows_ || matrix_.empty() ||
+         other.matrix_.empty();
+}
+
+template <typename T>
+void S21BasicMatrix<T>::CheckSquare() const {
+  if (rows_ != cols_ || matrix_.empty()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_BASIC_MATRIX_H_
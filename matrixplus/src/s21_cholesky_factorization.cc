@@ -0,0 +1,103 @@
+#include "s21_cholesky_factorization.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "s21_matrix_lu.h"
+
+S21CholeskyFactorization::S21CholeskyFactorization(const S21Matrix &matrix)
+    : l_(matrix) {
+  if (l_.rows_ != l_.cols_ || l_.rows_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  // Rounding in whatever built the matrix grows with its entries, so the
+  // mismatch allowed between a_ij and a_ji does too, as for the pivots.
+  double scale = 0.0;
+  for (int i = 0; i < l_.rows_; i++) {
+    for (int j = 0; j < l_.cols_; j++) {
+      scale = std::max(scale, fabs(l_.Row(i)[j]));
+    }
+  }
+  for (int i = 0; i < l_.rows_; i++) {
+    for (int j = 0; j < i; j++) {
+      if (fabs(l_.Row(i)[j] - l_.Row(j)[i]) >
+          S21Tolerance<double>::kValue * scale) {
+        throw std::invalid_argument(
+            "Invalid argument! Matrix is not symmetric");
+      }
+    }
+  }
+  Factor();
+}
+
+S21CholeskyFactorization::S21CholeskyFactorization(
+    const S21SymmetricMatrix &matrix)
+    : l_(matrix.GetSize() > 0 ? matrix.ToMatrix() : S21Matrix()) {
+  if (l_.rows_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  Factor();
+}
+
+S21Matrix S21CholeskyFactorization::Solve(const S21MatrixView &b) const {
+  if (b.GetRows() != GetSize()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21Matrix res(b);
+  SolveInPlace(res);
+  return res;
+}
+
+std::vector<double> S21CholeskyFactorization::Solve(
+    const std::vector<double> &b) const {
+  std::vector<double> res(b);
+  SolveInPlace(res);
+  return res;
+}
+
+void S21CholeskyFactorization::SolveInPlace(S21Matrix &b) const {
+  if (b.rows_ != GetSize()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  s21::CholeskySolve(l_.matrix_, l_.rows_, l_.ld_, b.matrix_, b.cols_, b.ld_);
+}
+
+void S21CholeskyFactorization::SolveInPlace(std::vector<double> &b) const {
+  if (b.size() != static_cast<std::size_t>(GetSize())) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  s21::CholeskySolve(l_.matrix_, l_.rows_, l_.ld_, b.data(), 1, 1);
+}
+
+double S21CholeskyFactorization::LogDeterminant() const noexcept {
+  double res = 0.0;
+  for (int i = 0; i < l_.rows_; i++) res += log(l_.Row(i)[i]);
+  return 2.0 * res;
+}
+
+S21Matrix S21CholeskyFactorization::Inverse() const {
+  S21Matrix res(GetSize(), GetSize());
+  for (int i = 0; i < GetSize(); i++) res.Row(i)[i] = 1.0;
+  SolveInPlace(res);
+  return res;
+}
+
+void S21CholeskyFactorization::Factor() {
+  // Every element of a positive definite matrix is bounded by the largest
+  // diagonal one, so pivots are judged against it.
+  double scale = 0.0;
+  for (int i = 0; i < l_.rows_; i++) scale = std::max(scale, l_.Row(i)[i]);
+  if (!s21::CholeskyFactor(l_.matrix_, l_.rows_, l_.ld_,
+                           S21Tolerance<double>::kValue * scale)) {
+    throw std::invalid_argument(
+        "Invalid argument! Matrix is not positive definite");
+  }
+  for (int i = 0; i < l_.rows_; i++) {
+    std::fill(l_.Row(i) + i + 1, l_.Row(i) + l_.cols_, 0.0);
+  }
+}
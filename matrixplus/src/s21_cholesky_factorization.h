@@ -0,0 +1,41 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_CHOLESKY_FACTORIZATION_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_CHOLESKY_FACTORIZATION_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_symmetric_matrix.h"
+
+// A = L L^T of a symmetric positive definite matrix, such as a covariance or
+// stiffness matrix: half the flops of S21LuFactorization and no pivoting.
+// Used the same way, factored once and then solved against repeatedly; the
+// factor is a copy of the matrix.
+class S21CholeskyFactorization {
+ public:
+  // Throws std::invalid_argument unless matrix is square, symmetric up to the
+  // S21Matrix tolerance times its largest entry and positive definite.
+  explicit S21CholeskyFactorization(const S21Matrix &matrix);
+  explicit S21CholeskyFactorization(const S21SymmetricMatrix &matrix);
+
+  int GetSize() const noexcept { return l_.GetRows(); }
+  // The lower triangular factor L.
+  const S21Matrix &GetFactor() const noexcept { return l_; }
+
+  // X with A * X = b; throws std::invalid_argument unless b has GetSize()
+  // rows.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  std::vector<double> Solve(const std::vector<double> &b) const;
+  // The same, overwriting b with X and allocating nothing.
+  void SolveInPlace(S21Matrix &b) const;
+  void SolveInPlace(std::vector<double> &b) const;
+  // log(det A), which stays finite where det A would overflow or underflow.
+  double LogDeterminant() const noexcept;
+  S21Matrix Inverse() const;
+
+ private:
+  S21Matrix l_;
+
+  void Factor();
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_CHOLESKY_FACTORIZATION_H_
@@ -0,0 +1,289 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_FIXED_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_FIXED_MATRIX_H_
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+
+// Calls f(0), f(1), ..., f(N - 1) as separate statements, so loops over
+// compile-time extents are unrolled regardless of the optimizer.
+template <typename F, int... I>
+constexpr void UnrollImpl(F &&f, std::integer_sequence<int, I...>) {
+  (f(I), ...);
+}
+
+template <int N, typename F>
+constexpr void Unroll(F &&f) {
+  UnrollImpl(f, std::make_integer_sequence<int, N>());
+}
+
+template <typename T>
+constexpr T Abs(T value) {
+  return value < T() ? -value : value;
+}
+
+}  // namespace s21
+
+// R x C matrix with inline storage for small geometry work: no allocation,
+// constexpr throughout, and shapes checked by the type system. operator()
+// does not check its indices.
+template <int R, int C, typename T = double>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0, "Invalid matrix size");
+
+ public:
+  constexpr S21FixedMatrix() : matrix_{} {}
+
+  // Row-major list of all R * C elements.
+  template <typename... Args,
+            typename = std::enable_if_t<
+                sizeof...(Args) == R * C &&
+                (std::is_convertible_v<Args, T> && ...)>>
+  constexpr S21FixedMatrix(Args... values)
+      : matrix_{static_cast<T>(values)...} {}
+
+  // Throws std::invalid_argument if other is not R x C.
+  explicit S21FixedMatrix(const S21BasicMatrix<T> &other) : matrix_{} {
+    if (other.GetRows() != R || other.GetCols() != C) {
+      throw std::invalid_argument(
+          "Invalid argument! Different matrix dimensions");
+    }
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) {
+        (*this)(i, j) = other(i, j);
+      }
+    }
+  }
+
+  explicit operator S21BasicMatrix<T>() const {
+    S21BasicMatrix<T> res(R, C);
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) {
+        res(i, j) = (*this)(i, j);
+      }
+    }
+    return res;
+  }
+
+  static constexpr int GetRows() { return R; }
+  static constexpr int GetCols() { return C; }
+
+  constexpr T &operator()(int i, int j) { return matrix_[i * C + j]; }
+  constexpr const T &operator()(int i, int j) const {
+    return matrix_[i * C + j];
+  }
+
+  static constexpr S21FixedMatrix Identity() {
+    static_assert(R == C, "Invalid argument! Different matrix dimensions");
+    S21FixedMatrix res;
+    s21::Unroll<R>([&](int i) { res(i, i) = T(1); });
+    return res;
+  }
+
+  constexpr bool EqMatrix(const S21FixedMatrix &other) const {
+    bool equal = true;
+    s21::Unroll<R * C>([&](int k) {
+      if constexpr (std::is_integral_v<T>) {
+        equal = equal && matrix_[k] == other.matrix_[k];
+      } else {
+        equal = equal && s21::Abs(matrix_[k] - other.matrix_[k]) <=
+                             S21Tolerance<T>::kValue;
+      }
+    });
+    return equal;
+  }
+
+  constexpr S21FixedMatrix &operator+=(const S21FixedMatrix &other) {
+    s21::Unroll<R * C>([&](int k) { matrix_[k] += other.matrix_[k]; });
+    return *this;
+  }
+
+  constexpr S21FixedMatrix &operator-=(const S21FixedMatrix &other) {
+    s21::Unroll<R * C>([&](int k) { matrix_[k] -= other.matrix_[k]; });
+    return *this;
+  }
+
+  constexpr S21FixedMatrix &operator*=(const T num) {
+    s21::Unroll<R * C>([&](int k) { matrix_[k] *= num; });
+    return *this;
+  }
+
+  constexpr S21FixedMatrix<C, R, T> Transpose() const {
+    S21FixedMatrix<C, R, T> res;
+    s21::Unroll<R>([&](int i) {
+      s21::Unroll<C>([&](int j) { res(j, i) = (*this)(i, j); });
+    });
+    return res;
+  }
+
+  constexpr S21FixedMatrix<R - 1, C - 1, T> MinorMatrix(int x, int y) const {
+    S21FixedMatrix<R - 1, C - 1, T> res;
+    s21::Unroll<R - 1>([&](int i) {
+      s21::Unroll<C - 1>([&](int j) {
+        res(i, j) = (*this)(i < x ? i : i + 1, j < y ? j : j + 1);
+      });
+    });
+    return res;
+  }
+
+  // Cofactor expansion, unrolled at compile time, up to 4 x 4; Gaussian
+  // elimination with partial pivoting above that.
+  constexpr T Determinant() const {
+    static_assert(R == C, "Invalid argument! Different matrix dimensions");
+    if constexpr (R == 1) {
+      return matrix_[0];
+    } else if constexpr (R == 2) {
+      return matrix_[0] * matrix_[3] - matrix_[1] * matrix_[2];
+    } else if constexpr (R <= 4) {
+      T res = T();
+      s21::Unroll<R>([&](int j) {
+        const T term = matrix_[j] * MinorMatrix(0, j).Determinant();
+        res += j % 2 == 0 ? term : -term;
+      });
+      return res;
+    } else {
+      S21FixedMatrix a(*this);
+      T res = T(1);
+      for (int k = 0; k < R; k++) {
+        int pivot = k;
+        for (int i = k + 1; i < R; i++) {
+          if (s21::Abs(a(i, k)) > s21::Abs(a(pivot, k))) pivot = i;
+        }
+        if (a(pivot, k) == T()) return T();
+        if (pivot != k) {
+          for (int j = 0; j < R; j++) {
+            const T temp = a(k, j);
+            a(k, j) = a(pivot, j);
+            a(pivot, j) = temp;
+          }
+          res = -res;
+        }
+        res *= a(k, k);
+        for (int i = k + 1; i < R; i++) {
+          const T l = a(i, k) / a(k, k);
+          for (int j = k + 1; j < R; j++) {
+            a(i, j) -= l * a(k, j);
+          }
+        }
+      }
+      return res;
+    }
+  }
+
+  constexpr S21FixedMatrix CalcComplements() const {
+    static_assert(R == C, "Invalid argument! Different matrix dimensions");
+    S21FixedMatrix res;
+    if constexpr (R == 1) {
+      res(0, 0) = T(1);
+    } else {
+      s21::Unroll<R>([&](int i) {
+        s21::Unroll<C>([&](int j) {
+          const T minor = MinorMatrix(i, j).Determinant();
+          res(i, j) = (i + j) % 2 == 0 ? minor : -minor;
+        });
+      });
+    }
+    return res;
+  }
+
+  // Throws std::invalid_argument for a singular matrix, by the test of
+  // S21Matrix::InverseMatrix(): some partial-pivoting pivot is no larger
+  // than the tolerance times the largest entry.
+  constexpr S21FixedMatrix InverseMatrix() const {
+    static_assert(R == C, "Invalid argument! Different matrix dimensions");
+    static_assert(!std::is_integral_v<T>,
+                  "Integer fixed matrices have no inverse");
+    if (!Regular()) {
+      throw std::invalid_argument("Matrix determinant is 0");
+    }
+    const T determinant = Determinant();
+    S21FixedMatrix res = CalcComplements().Transpose();
+    res *= T(1) / determinant;
+    return res;
+  }
+
+  friend constexpr bool operator==(const S21FixedMatrix &lhs,
+                                   const S21FixedMatrix &rhs) {
+    return lhs.EqMatrix(rhs);
+  }
+
+  friend constexpr S21FixedMatrix operator+(S21FixedMatrix lhs,
+                                            const S21FixedMatrix &rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr S21FixedMatrix operator-(S21FixedMatrix lhs,
+                                            const S21FixedMatrix &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr S21FixedMatrix operator*(S21FixedMatrix matrix,
+                                            const T num) {
+    return matrix *= num;
+  }
+
+  friend constexpr S21FixedMatrix operator*(const T num,
+                                            S21FixedMatrix matrix) {
+    return matrix *= num;
+  }
+
+ private:
+  T matrix_[R * C];
+
+  constexpr bool Regular() const {
+    T scale = T();
+    s21::Unroll<R * C>([&](int k) {
+      const T value = s21::Abs(matrix_[k]);
+      scale = value > scale ? value : scale;
+    });
+    const T limit = S21Tolerance<T>::kValue * scale;
+    S21FixedMatrix a(*this);
+    for (int k = 0; k < R; k++) {
+      int pivot = k;
+      for (int i = k + 1; i < R; i++) {
+        if (s21::Abs(a(i, k)) > s21::Abs(a(pivot, k))) pivot = i;
+      }
+      if (!(s21::Abs(a(pivot, k)) > limit)) return false;
+      for (int j = k; j < R; j++) {
+        const T temp = a(k, j);
+        a(k, j) = a(pivot, j);
+        a(pivot, j) = temp;
+      }
+      for (int i = k + 1; i < R; i++) {
+        const T l = a(i, k) / a(k, k);
+        for (int j = k + 1; j < R; j++) {
+          a(i, j) -= l * a(k, j);
+        }
+      }
+    }
+    return true;
+  }
+};
+
+// Only defined when the inner dimensions agree, so a mismatch is a compile
+// error rather than an exception.
+template <int R, int K, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> operator*(
+    const S21FixedMatrix<R, K, T> &lhs, const S21FixedMatrix<K, C, T> &rhs) {
+  S21FixedMatrix<R, C, T> res;
+  s21::Unroll<R>([&](int i) {
+    s21::Unroll<C>([&](int j) {
+      T sum = T();
+      s21::Unroll<K>([&](int k) { sum += lhs(i, k) * rhs(k, j); });
+      res(i, j) = sum;
+    });
+  });
+  return res;
+}
+
+template <int N, typename T>
+constexpr S21FixedMatrix<N, N, T> &operator*=(
+    S21FixedMatrix<N, N, T> &lhs, const S21FixedMatrix<N, N, T> &rhs) {
+  return lhs = lhs * rhs;
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_FIXED_MATRIX_H_
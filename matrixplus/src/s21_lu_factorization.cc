@@ -0,0 +1,66 @@
+#include "s21_lu_factorization.h"
+
+#include <stdexcept>
+
+#include "s21_matrix_lu.h"
+
+S21Matrix S21Matrix::Solve(const S21MatrixView &b) const {
+  return S21LuFactorization(*this).Solve(b);
+}
+
+S21LuFactorization::S21LuFactorization(const S21Matrix &matrix) : sign_(0) {
+  if (matrix.rows_ != matrix.cols_) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  if (!matrix.FactorLu(lu_, perm_, sign_)) {
+    throw std::invalid_argument("Matrix determinant is 0");
+  }
+}
+
+S21Matrix S21LuFactorization::Solve(const S21MatrixView &b) const {
+  if (b.GetRows() != GetSize()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21Matrix res(b);
+  SolveInPlace(res);
+  return res;
+}
+
+std::vector<double> S21LuFactorization::Solve(
+    const std::vector<double> &b) const {
+  std::vector<double> res(b);
+  SolveInPlace(res);
+  return res;
+}
+
+void S21LuFactorization::SolveInPlace(S21Matrix &b) const {
+  if (b.rows_ != GetSize()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  s21::LuSolve(lu_.matrix_, lu_.rows_, lu_.ld_, perm_.data(), b.matrix_,
+               b.cols_, b.ld_);
+}
+
+void S21LuFactorization::SolveInPlace(std::vector<double> &b) const {
+  if (b.size() != static_cast<std::size_t>(GetSize())) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  s21::LuSolve(lu_.matrix_, lu_.rows_, lu_.ld_, perm_.data(), b.data(), 1, 1);
+}
+
+double S21LuFactorization::Determinant() const noexcept {
+  double res = sign_;
+  for (int i = 0; i < lu_.rows_; i++) res *= lu_.Row(i)[i];
+  return res;
+}
+
+S21Matrix S21LuFactorization::Inverse() const {
+  S21Matrix res(GetSize(), GetSize());
+  for (int i = 0; i < GetSize(); i++) res.Row(i)[i] = 1.0;
+  SolveInPlace(res);
+  return res;
+}
@@ -0,0 +1,35 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_LU_FACTORIZATION_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_LU_FACTORIZATION_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// PA = LU of a square matrix, factored once in O(n^3) and then reused: every
+// right-hand side costs only the two O(n^2) triangular solves. The factors
+// are a copy, so the matrix may change or go away afterwards.
+class S21LuFactorization {
+ public:
+  // Throws std::invalid_argument unless matrix is square and regular, with
+  // the same singularity test as S21Matrix::InverseMatrix().
+  explicit S21LuFactorization(const S21Matrix &matrix);
+
+  int GetSize() const noexcept { return lu_.GetRows(); }
+
+  // X with A * X = b; throws std::invalid_argument unless b has GetSize()
+  // rows.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  std::vector<double> Solve(const std::vector<double> &b) const;
+  // The same, overwriting b with X and allocating nothing.
+  void SolveInPlace(S21Matrix &b) const;
+  void SolveInPlace(std::vector<double> &b) const;
+  double Determinant() const noexcept;
+  S21Matrix Inverse() const;
+
+ private:
+  S21Matrix lu_;
+  std::vector<int> perm_;
+  int sign_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_LU_FACTORIZATION_H_
@@ -1,9 +1,142 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
+#include "s21_lu_factorization.h"
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_lu.h"
 #include "s21_matrix_oop.h"
+#include "s21_matrix_simd.h"
+#include "s21_matrix_small.h"
+#include "s21_matrix_strassen.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// Square tiles of this size from source and destination fit in L1 together.
+constexpr int kTransposeTile = 32;
+
+// Leading dimensions that are a multiple of this many doubles get one more
+// cache line of padding.
+constexpr int kConflictStride = 512;
+
+// Splits a side longer than one tile in two, keeping the first part a
+// multiple of the 4 x 4 register blocks of the SIMD transpose.
+int TransposeSplit(int n) { return n / 8 * 4; }
+
+// dst = src^T, dst being rows x cols. The longer side is halved until both
+// fit in a tile, so every level of the cache hierarchy sees blocks that fit
+// it, whatever its size.
+template <typename T>
+void TransposeBlock(const s21::BasicSimdKernels<T> &simd, const T *src,
+                    std::ptrdiff_t lds, T *dst, std::ptrdiff_t ldd, int rows,
+                    int cols) {
+  if (rows <= kTransposeTile && cols <= kTransposeTile) {
+    simd.transpose(src, lds, dst, ldd, rows, cols);
+  } else if (rows >= cols) {
+    const int half = TransposeSplit(rows);
+    TransposeBlock(simd, src, lds, dst, ldd, half, cols);
+    TransposeBlock(simd, src + half, lds, dst + half * ldd, ldd, rows - half,
+                   cols);
+  } else {
+    const int half = TransposeSplit(cols);
+    TransposeBlock(simd, src, lds, dst, ldd, rows, half);
+    TransposeBlock(simd, src + half * lds, lds, dst + half, ldd, rows,
+                   cols - half);
+  }
+}
+
+// Exchanges the rows x cols block a with the transpose of the cols x rows
+// block b; the two must not overlap. Tiles go through a buffer on the stack.
+void TransposeSwap(const s21::SimdKernels &simd, double *a, double *b,
+                   std::ptrdiff_t ld, int rows, int cols) {
+  if (rows <= kTransposeTile && cols <= kTransposeTile) {
+    double tile[kTransposeTile * kTransposeTile];
+    simd.transpose(a, ld, tile, kTransposeTile, cols, rows);
+    simd.transpose(b, ld, a, ld, rows, cols);
+    for (int i = 0; i < cols; i++) {
+      std::memcpy(b + i * ld, tile + i * kTransposeTile, sizeof(double) * rows);
+    }
+  } else if (rows >= cols) {
+    const int half = TransposeSplit(rows);
+    TransposeSwap(simd, a, b, ld, half, cols);
+    TransposeSwap(simd, a + half * ld, b + half, ld, rows - half, cols);
+  } else {
+    const int half = TransposeSplit(cols);
+    TransposeSwap(simd, a, b, ld, rows, half);
+    TransposeSwap(simd, a + half, b + half * ld, ld, rows, cols - half);
+  }
+}
+
+// Transposes the n x n block a in place.
+void TransposeDiagonal(const s21::SimdKernels &simd, double *a,
+                       std::ptrdiff_t ld, int n) {
+  if (n <= kTransposeTile) {
+    double tile[kTransposeTile * kTransposeTile];
+    simd.transpose(a, ld, tile, kTransposeTile, n, n);
+    for (int i = 0; i < n; i++) {
+      std::memcpy(a + i * ld, tile + i * kTransposeTile, sizeof(double) * n);
+    }
+  } else {
+    const int half = TransposeSplit(n);
+    TransposeDiagonal(simd, a, ld, half);
+    TransposeDiagonal(simd, a + half * ld + half, ld, n - half);
+    TransposeSwap(simd, a + half, a + half * ld, ld, half, n - half);
+  }
+}
+
+// The singularity test of every order: partial-pivot LU of the n x n block
+// a, in place, has to keep each pivot above the tolerance relative to the
+// largest entry of A, so scaling a matrix never changes the verdict.
+bool FactorRegular(double *a, int n, std::ptrdiff_t lda, int *perm,
+                   int &sign) {
+  double scale = 0.0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      scale = std::max(scale, fabs(a[i * lda + j]));
+    }
+  }
+  sign = s21::LuFactor(a, n, lda, perm);
+  bool regular = sign != 0;
+  for (int i = 0; i < n && regular; i++) {
+    regular = fabs(a[i * lda + i]) > S21Tolerance<double>::kValue * scale;
+  }
+  return regular;
+}
+
+}  // namespace
+
+namespace s21 {
+
+template <typename T>
+void Transpose(const T *src, std::ptrdiff_t lds, T *dst, std::ptrdiff_t ldd,
+               int rows, int cols) {
+  const BasicSimdKernels<T> &simd = Simd<T>();
+  const int tiles = (cols + kTransposeTile - 1) / kTransposeTile;
+  ParallelFor(tiles, static_cast<long>(rows) * cols, [&](int begin, int end) {
+    const int i_begin = begin * kTransposeTile;
+    const int i_end = std::min(cols, end * kTransposeTile);
+    TransposeBlock(simd, src + i_begin, lds, dst + i_begin * ldd, ldd,
+                   i_end - i_begin, rows);
+  });
+}
+
+template void Transpose(const double *, std::ptrdiff_t, double *,
+                        std::ptrdiff_t, int, int);
+template void Transpose(const float *, std::ptrdiff_t, float *,
+                        std::ptrdiff_t, int, int);
+
+}  // namespace s21
 
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+S21Matrix::S21BasicMatrix()
+    : rows_(0), cols_(0), ld_(0), matrix_(nullptr), resource_(nullptr) {}
 
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+S21Matrix::S21BasicMatrix(int rows, int cols)
+    : rows_(rows),
+      cols_(cols),
+      ld_(0),
+      matrix_(nullptr),
+      resource_(nullptr) {
   if (rows_ > 0 && cols_ > 0) {
     CreateMatrix();
   } else {
@@ -11,42 +144,42 @@ S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
   }
 }
 
-S21Matrix::S21Matrix(const S21Matrix &other)
-    : rows_(other.rows_), cols_(other.cols_) {
-  CreateMatrix();
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
+S21Matrix::S21BasicMatrix(const S21Matrix &other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      ld_(0),
+      matrix_(nullptr),
+      resource_(nullptr) {
+  if (other.matrix_ != nullptr) {
+    CreateMatrix(false);
+    std::memcpy(matrix_, other.matrix_, Bytes());
   }
 }
 
-S21Matrix::S21Matrix(S21Matrix &&other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+S21Matrix::S21BasicMatrix(S21Matrix &&other) noexcept
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      ld_(other.ld_),
+      matrix_(other.matrix_),
+      resource_(other.resource_) {
   other.rows_ = 0;
   other.cols_ = 0;
+  other.ld_ = 0;
   other.matrix_ = nullptr;
+  other.resource_ = nullptr;
 }
 
-S21Matrix::~S21Matrix() {
-  if (matrix_ != nullptr) {
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
-    matrix_ = nullptr;
-  }
-  rows_ = 0;
-  cols_ = 0;
-}
+S21Matrix::~S21BasicMatrix() { FreeMatrix(); }
 
 bool S21Matrix::EqMatrix(const S21Matrix &other) const noexcept {
   if (CheckMatrix(other)) {
     return false;
   } else {
+    const s21::SimdKernels &simd = s21::Simd();
     for (int i = 0; i < rows_; i++) {
-      for (int j = 0; j < cols_; j++) {
-        if (fabs(matrix_[i][j] - other.matrix_[i][j]) > eps) return false;
+      if (!simd.equal(Row(i), other.Row(i), cols_,
+                      S21Tolerance<double>::kValue)) {
+        return false;
       }
     }
   }
@@ -58,33 +191,40 @@ void S21Matrix::SumMatrix(const S21Matrix &other) {
     throw std::invalid_argument(
         "Invalid argument! Different matrix dimensions");
   } else {
-    for (int i = 0; i < rows_; i++) {
-      for (int j = 0; j < cols_; j++) {
-        matrix_[i][j] += other.matrix_[i][j];
+    const s21::SimdKernels &simd = s21::Simd();
+    s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        simd.add(Row(i), other.Row(i), cols_);
       }
-    }
+    });
   }
 }
 
+void S21Matrix::SumMatrix(const S21MatrixView &other) { *this += other; }
+
 void S21Matrix::SubMatrix(const S21Matrix &other) {
   if (CheckMatrix(other)) {
     throw std::invalid_argument(
         "Invalid argument! Different matrix dimensions");
   } else {
-    for (int i = 0; i < rows_; i++) {
-      for (int j = 0; j < cols_; j++) {
-        matrix_[i][j] -= other.matrix_[i][j];
+    const s21::SimdKernels &simd = s21::Simd();
+    s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        simd.sub(Row(i), other.Row(i), cols_);
       }
-    }
+    });
   }
 }
 
+void S21Matrix::SubMatrix(const S21MatrixView &other) { *this -= other; }
+
 void S21Matrix::MulNumber(const double num) {
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] *= num;
+  const s21::SimdKernels &simd = s21::Simd();
+  s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      simd.scale(Row(i), num, cols_);
     }
-  }
+  });
 }
 
 void S21Matrix::MulMatrix(const S21Matrix &other) {
@@ -93,134 +233,257 @@ void S21Matrix::MulMatrix(const S21Matrix &other) {
         "Invalid argument! Different matrix dimensions");
   } else {
     S21Matrix res(rows_, other.cols_);
-    for (int i = 0; i < rows_; i++) {
-      for (int j = 0; j < other.cols_; j++) {
-        for (int m = 0; m < other.rows_; m++) {
-          res.matrix_[i][j] += matrix_[i][m] * other.matrix_[m][j];
-        }
-      }
-    }
-
-    *this = res;
+    Product(*this, other, res);
+    *this = std::move(res);
   }
 }
 
-S21Matrix S21Matrix::Transpose() {
-  S21Matrix res(cols_, rows_);
-  for (int i = 0; i < cols_; i++) {
-    for (int j = 0; j < rows_; j++) {
-      res.matrix_[i][j] = matrix_[j][i];
-    }
-  }
-  return res;
+void S21Matrix::MulMatrix(const S21MatrixView &other) {
+  S21Matrix res;
+  Multiply(*this, other, res);
+  *this = std::move(res);
 }
 
-S21Matrix S21Matrix::MinorMatrix(const int x, const int y) {
-  if (x < 0 || x >= rows_ || y < 0 || y >= cols_) {
+void S21Matrix::Multiply(const S21MatrixView &a, const S21MatrixView &b,
+                         S21Matrix &out) {
+  if (a.GetCols() != b.GetRows() || a.GetRows() == 0 || a.GetCols() == 0 ||
+      b.GetCols() == 0) {
     throw std::invalid_argument(
         "Invalid argument! Different matrix dimensions");
+  } else if (a.Overlaps(out) || b.Overlaps(out)) {
+    S21Matrix res = Uninitialized(a.GetRows(), b.GetCols());
+    Product(a, b, res);
+    out = std::move(res);
   } else {
-    S21Matrix res(rows_ - 1, cols_ - 1);
-    for (int i = 0, min_i = 0; min_i < res.rows_; ++min_i) {
-      if (x == i) ++i;
-      for (int j = 0, min_j = 0; min_j < res.cols_; ++min_j) {
-        if (y == j) ++j;
-        res.matrix_[min_i][min_j] = matrix_[i][j];
-        ++j;
-      }
-      ++i;
+    if (out.rows_ != a.GetRows() || out.cols_ != b.GetCols()) {
+      out = Uninitialized(a.GetRows(), b.GetCols());
     }
-    return res;
+    Product(a, b, out);
   }
 }
 
-S21Matrix S21Matrix::CalcComplements() {
-  S21Matrix res(rows_, cols_);
-  if (rows_ != cols_) {
-    throw std::invalid_argument(
-        "Invalid argument! Different matrix dimensions");
+void S21Matrix::Product(const S21MatrixView &a, const S21MatrixView &b,
+                        S21Matrix &out) {
+  const int m = a.GetRows(), n = b.GetCols(), k = a.GetCols();
+  const int crossover = s21::StrassenCrossover();
+  if (crossover > 0 && std::min({m, n, k}) > crossover &&
+      a.GetColStride() == 1 && b.GetColStride() == 1) {
+    s21::StrassenGemm(m, n, k, a.Data(), a.GetRowStride(), b.Data(),
+                      b.GetRowStride(), out.matrix_, out.ld_, crossover);
   } else {
-    for (int i = 0; i < rows_; i++) {
-      for (int j = 0; j < cols_; j++) {
-        S21Matrix minor = MinorMatrix(i, j);
-        res.matrix_[i][j] = pow((-1), i + j) * minor.Determinant();
-      }
-    }
+    s21::Gemm(m, n, k, 1.0, a.Data(), a.GetRowStride(), a.GetColStride(),
+              b.Data(), b.GetRowStride(), b.GetColStride(), 0.0, out.matrix_,
+              out.ld_);
   }
-  return res;
 }
 
-double S21Matrix::Determinant() {
-  if (rows_ != cols_) {
+void S21Matrix::Gemm(S21Transpose trans_a, S21Transpose trans_b,
+                     double alpha, const S21MatrixView &a,
+                     const S21MatrixView &b, double beta, S21Matrix &c) {
+  const int m = trans_a == S21Transpose::kTranspose ? a.GetCols() : a.GetRows();
+  const int n = trans_b == S21Transpose::kTranspose ? b.GetRows() : b.GetCols();
+  if (c.rows_ == m && c.cols_ == n) {
+    Gemm(trans_a, trans_b, alpha, a, b, beta, c.Block(0, 0, m, n));
+  } else if (beta != 0.0 || m == 0 || n == 0) {
     throw std::invalid_argument(
         "Invalid argument! Different matrix dimensions");
   } else {
-    double res = 0.0;
-    if (rows_ == 1) {
-      res = matrix_[0][0];
-    } else if (rows_ == 2) {
-      res = matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
-    } else {
-      for (int i = 0; i < cols_; i++) {
-        S21Matrix minor = MinorMatrix(0, i);
-        res += matrix_[0][i] * pow(-1, i) * minor.Determinant();
-      }
-    }
-    return res;
+    S21Matrix res = Uninitialized(m, n);
+    Gemm(trans_a, trans_b, alpha, a, b, 0.0, res.Block(0, 0, m, n));
+    c = std::move(res);
   }
 }
 
-S21Matrix S21Matrix::InverseMatrix() {
-  double determinant = Determinant();
-  if (fabs(determinant) < eps) {
-    throw std::invalid_argument("Matrix determinant is 0");
+void S21Matrix::Gemm(S21Transpose trans_a, S21Transpose trans_b,
+                     double alpha, const S21MatrixView &a,
+                     const S21MatrixView &b, double beta,
+                     S21MatrixBlock c) {
+  S21MatrixView op_a = trans_a == S21Transpose::kTranspose ? a.Transpose() : a;
+  S21MatrixView op_b = trans_b == S21Transpose::kTranspose ? b.Transpose() : b;
+  const int m = op_a.GetRows(), n = op_b.GetCols(), k = op_a.GetCols();
+  if (k != op_b.GetRows() || m != c.GetRows() || n != c.GetCols() || m == 0 ||
+      n == 0 || k == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
   }
-  S21Matrix res(rows_, cols_);
-  if (rows_ == 1) {
-    res.matrix_[0][0] = 1 / matrix_[0][0];
-  } else {
-    S21Matrix tmp = CalcComplements();
-    res = tmp.Transpose();
-    res.MulNumber(1 / determinant);
+  // Operands sharing storage with c are copied before c is written.
+  S21Matrix a_copy, b_copy;
+  if (op_a.Overlaps(c)) {
+    a_copy = op_a;
+    op_a = a_copy;
   }
-  return res;
+  if (op_b.Overlaps(c)) {
+    b_copy = op_b;
+    op_b = b_copy;
+  }
+  if (c.GetColStride() != 1) {
+    // The kernel writes rows of c contiguously.
+    S21Matrix res(c);
+    Gemm(S21Transpose::kNone, S21Transpose::kNone, alpha, op_a, op_b, beta,
+         res.Block(0, 0, m, n));
+    c = res;
+    return;
+  }
+  s21::Gemm(m, n, k, alpha, op_a.Data(), op_a.GetRowStride(),
+            op_a.GetColStride(), op_b.Data(), op_b.GetRowStride(),
+            op_b.GetColStride(), beta, c.Data(), c.GetRowStride());
 }
 
-S21Matrix S21Matrix::operator+(const S21Matrix &other) {
-  S21Matrix res(*this);
-  res.SumMatrix(other);
-  return res;
+S21MatrixView S21Matrix::TransposedView() const {
+  return S21MatrixView(*this).Transpose();
 }
 
-S21Matrix S21Matrix::operator-(const S21Matrix &other) {
-  S21Matrix res(*this);
-  res.SubMatrix(other);
-  return res;
+S21MatrixBlock S21Matrix::Block(int row, int col, int rows, int cols) {
+  S21MatrixView(*this).Block(row, col, rows, cols);  // Checks the bounds.
+  return S21MatrixBlock(Row(row) + col, rows, cols, ld_, 1);
 }
 
-S21Matrix S21Matrix::operator*(const S21Matrix &other) {
-  S21Matrix res(*this);
-  res.MulMatrix(other);
+S21MatrixView S21Matrix::Block(int row, int col, int rows, int cols) const {
+  return S21MatrixView(*this).Block(row, col, rows, cols);
+}
+
+S21Matrix S21Matrix::Transpose() const {
+  S21Matrix res = Uninitialized(cols_, rows_);
+  s21::Transpose(matrix_, ld_, res.matrix_, res.ld_, rows_, cols_);
   return res;
 }
 
-S21Matrix S21Matrix::operator*(const double num) {
-  S21Matrix res(*this);
-  res.MulNumber(num);
+void S21Matrix::TransposeInPlace() {
+  if (rows_ != cols_) {
+    *this = Transpose();
+    return;
+  }
+  // Stripe t owns the diagonal tile t, the tiles to its right and the tiles
+  // below it, so stripes touch disjoint elements. Pairing stripe t with
+  // stripe tiles - 1 - t evens out their triangular cost.
+  const s21::SimdKernels &simd = s21::Simd();
+  const int tiles = (rows_ + kTransposeTile - 1) / kTransposeTile;
+  auto stripe = [&](int t) {
+    const int begin = t * kTransposeTile;
+    const int size = std::min(kTransposeTile, rows_ - begin);
+    const int end = begin + size;
+    TransposeDiagonal(simd, Row(begin) + begin, ld_, size);
+    if (end < rows_) {
+      TransposeSwap(simd, Row(begin) + end, Row(end) + begin, ld_, size,
+                    rows_ - end);
+    }
+  };
+  s21::ParallelFor((tiles + 1) / 2, Size() / 2, [&](int begin, int end) {
+    for (int t = begin; t < end; t++) {
+      stripe(t);
+      if (tiles - 1 - t != t) stripe(tiles - 1 - t);
+    }
+  });
+}
+
+S21Matrix S21Matrix::CalcComplements() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  const int n = rows_;
+  if (n <= s21::kSmallMaxSize) {
+    S21Matrix res(n, n);
+    s21::SmallAdjugate(matrix_, ld_, n, res.matrix_, res.ld_);
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) {
+        std::swap(res.Row(i)[j], res.Row(j)[i]);
+      }
+    }
+    return res;
+  }
+  S21Matrix lu;
+  std::vector<int> perm;
+  int sign = 0;
+  S21Matrix res(n, n);
+  if (FactorLu(lu, perm, sign)) {
+    double determinant = sign;
+    for (int i = 0; i < n; i++) {
+      res.Row(i)[i] = 1.0;
+      determinant *= lu.Row(i)[i];
+    }
+    s21::LuSolve(lu.matrix_, n, lu.ld_, perm.data(), res.matrix_, n, res.ld_);
+    res.MulNumber(determinant);
+  } else {
+    lu = *this;
+    s21::Adjugate(lu.matrix_, n, lu.ld_, res.matrix_, res.ld_);
+  }
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      std::swap(res.Row(i)[j], res.Row(j)[i]);
+    }
+  }
   return res;
 }
 
-S21Matrix operator*(double num, S21Matrix &other) {
-  S21Matrix res(other);
-  res.MulNumber(num);
+double S21Matrix::Determinant() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  } else if (rows_ <= s21::kSmallMaxSize) {
+    return s21::SmallDeterminant(matrix_, ld_, rows_);
+  } else {
+    std::vector<double> lu(matrix_,
+                           matrix_ + static_cast<std::size_t>(rows_) * ld_);
+    double res = s21::LuFactor(lu.data(), rows_, ld_, nullptr);
+    for (int i = 0; i < rows_ && res != 0.0; i++) {
+      res *= lu[static_cast<std::size_t>(i) * ld_ + i];
+    }
+    return res;
+  }
+}
+
+S21Matrix S21Matrix::InverseMatrix() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  } else if (rows_ <= s21::kSmallMaxSize) {
+    return SmallInverse();
+  }
+  return S21LuFactorization(*this).Inverse();
+}
+
+S21Matrix S21Matrix::SmallInverse() const {
+  const int n = rows_;
+  double lu[s21::kSmallMaxSize * s21::kSmallMaxSize];
+  int perm[s21::kSmallMaxSize], sign = 0;
+  for (int i = 0; i < n; i++) {
+    std::memcpy(lu + i * s21::kSmallMaxSize, Row(i), sizeof(double) * n);
+  }
+  if (!FactorRegular(lu, n, s21::kSmallMaxSize, perm, sign)) {
+    throw std::invalid_argument("Matrix determinant is 0");
+  }
+  double adj[s21::kSmallMaxSize * s21::kSmallMaxSize];
+  const double determinant =
+      s21::SmallAdjugate(matrix_, ld_, n, adj, s21::kSmallMaxSize);
+  S21Matrix res(n, n);
+  const double inv_det = 1 / determinant;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      res.Row(i)[j] = adj[i * s21::kSmallMaxSize + j] * inv_det;
+    }
+  }
   return res;
 }
 
 S21Matrix &S21Matrix::operator=(const S21Matrix &other) {
-  S21Matrix temp_matrix(other);
-  std::swap(rows_, temp_matrix.rows_);
-  std::swap(cols_, temp_matrix.cols_);
-  std::swap(matrix_, temp_matrix.matrix_);
+  if (this == &other) {
+    return *this;
+  } else if (rows_ == other.rows_ && cols_ == other.cols_ &&
+             matrix_ != nullptr) {
+    std::memcpy(matrix_, other.matrix_, Bytes());
+  } else {
+    S21Matrix temp_matrix(other);
+    Swap(temp_matrix);
+  }
+  return *this;
+}
+
+S21Matrix &S21Matrix::operator=(S21Matrix &&other) noexcept {
+  if (this != &other) {
+    FreeMatrix();
+    Swap(other);
+  }
   return *this;
 }
 
@@ -251,13 +514,13 @@ S21Matrix &S21Matrix::operator*=(const double num) {
 double &S21Matrix::operator()(const int i, const int j) {
   if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
     throw std::out_of_range("Index outside the matrix");
-  return matrix_[i][j];
+  return Row(i)[j];
 }
 
 double S21Matrix::operator()(const int i, const int j) const {
   if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
     throw std::out_of_range("Index outside the matrix");
-  return matrix_[i][j];
+  return Row(i)[j];
 }
 
 void S21Matrix::SetCols(const int cols) {
@@ -266,11 +529,10 @@ void S21Matrix::SetCols(const int cols) {
   }
   S21Matrix temp_matrix(rows_, cols);
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < std::min(cols, cols_); j++) {
-      temp_matrix.matrix_[i][j] = matrix_[i][j];
-    }
+    std::memcpy(temp_matrix.Row(i), Row(i),
+                sizeof(double) * std::min(cols, cols_));
   }
-  *this = temp_matrix;
+  *this = std::move(temp_matrix);
 }
 
 void S21Matrix::SetRows(const int rows) {
@@ -278,23 +540,68 @@ void S21Matrix::SetRows(const int rows) {
     throw std::out_of_range("Invalid matrix size");
   }
   S21Matrix temp_matrix(rows, cols_);
-  for (int i = 0; i < std::min(rows, rows_); i++) {
-    for (int j = 0; j < cols_; j++) {
-      temp_matrix.matrix_[i][j] = matrix_[i][j];
-    }
+  if (matrix_ != nullptr) {
+    const std::size_t kept = static_cast<std::size_t>(std::min(rows, rows_));
+    std::memcpy(temp_matrix.matrix_, matrix_, sizeof(double) * kept * ld_);
   }
-  *this = temp_matrix;
+  *this = std::move(temp_matrix);
 }
 
-int S21Matrix::GetCols() { return cols_; }
+int S21Matrix::GetCols() const { return cols_; }
+
+int S21Matrix::GetRows() const { return rows_; }
+
+void S21Matrix::CreateMatrix(bool zero) {
+  const int per_line = static_cast<int>(kAlignment / sizeof(double));
+  ld_ = (cols_ + per_line - 1) / per_line * per_line;
+  // Rows a multiple of 4 KiB apart map to the same cache sets, so walking
+  // down a column, as the transpose and the GEMM packing do, would evict
+  // its own lines.
+  if (ld_ % kConflictStride == 0) ld_ += per_line;
+  resource_ = GetMemoryResource();
+  matrix_ = static_cast<double *>(resource_->allocate(Bytes(), kAlignment));
+  if (zero) {
+    std::memset(matrix_, 0, Bytes());
+  } else if (ld_ != cols_) {
+    for (int i = 0; i < rows_; i++) {
+      std::memset(Row(i) + cols_, 0, sizeof(double) * (ld_ - cols_));
+    }
+  }
+}
 
-int S21Matrix::GetRows() { return rows_; }
+S21Matrix S21Matrix::Uninitialized(int rows, int cols) {
+  if (rows <= 0 || cols <= 0) throw std::out_of_range("Invalid matrix size");
+  S21Matrix res;
+  res.rows_ = rows;
+  res.cols_ = cols;
+  res.CreateMatrix(false);
+  return res;
+}
 
-void S21Matrix::CreateMatrix() {
-  matrix_ = new double *[rows_];
-  for (int i = 0; i < rows_; i++) {
-    matrix_[i] = new double[cols_]();
+void S21Matrix::FreeMatrix() noexcept {
+  if (matrix_ != nullptr) {
+    resource_->deallocate(matrix_, Bytes(), kAlignment);
+    matrix_ = nullptr;
   }
+  rows_ = 0;
+  cols_ = 0;
+  ld_ = 0;
+  resource_ = nullptr;
+}
+
+void S21Matrix::Swap(S21Matrix &other) noexcept {
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(ld_, other.ld_);
+  std::swap(matrix_, other.matrix_);
+  std::swap(resource_, other.resource_);
+}
+
+bool S21Matrix::FactorLu(S21Matrix &lu, std::vector<int> &perm,
+                         int &sign) const {
+  lu = *this;
+  perm.resize(rows_);
+  return FactorRegular(lu.matrix_, rows_, lu.ld_, perm.data(), sign);
 }
 
 bool S21Matrix::CheckMatrix(const S21Matrix &other) const {
@@ -0,0 +1,392 @@
+#include "s21_matrix_batch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_simd.h"
+#include "s21_thread_pool.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#endif
+
+namespace {
+
+constexpr int kLanes = S21MatrixBatch::kLanes;
+// Largest order eliminated in a stack buffer (16 KB); larger batches pass
+// scratch for every group.
+constexpr int kStackOrder = 16;
+
+// Element (i, j) of the kLanes matrices of a group. Only 8-byte aligned, so
+// it can be loaded from any group of any batch. Lanes are passed by
+// reference only: by value their ABI would depend on the SIMD target.
+typedef double Lane
+    __attribute__((vector_size(kLanes * sizeof(double)), aligned(8)));
+
+inline __attribute__((always_inline)) void Load(Lane &x, const double *p) {
+  std::memcpy(&x, p, sizeof(x));
+}
+
+inline __attribute__((always_inline)) void Store(double *p, const Lane &x) {
+  std::memcpy(p, &x, sizeof(x));
+}
+
+// Groups begin to end of out = a * b, a being m x k and b k x n. Like the
+// kernel below, it is inlined into one copy per SIMD target, whose registers
+// the generic vectors are lowered to.
+inline __attribute__((always_inline)) void MultiplyGroups(
+    const double *a, const double *b, double *out, int m, int k, int n,
+    int begin, int end) {
+  const std::size_t a_size = static_cast<std::size_t>(m) * k * kLanes;
+  const std::size_t b_size = static_cast<std::size_t>(k) * n * kLanes;
+  const std::size_t out_size = static_cast<std::size_t>(m) * n * kLanes;
+  for (int g = begin; g < end; g++) {
+    const double *group_a = a + g * a_size, *group_b = b + g * b_size;
+    double *group_out = out + g * out_size;
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < n; j++) {
+        Lane sum = {}, x, y;
+        for (int p = 0; p < k; p++) {
+          Load(x, group_a + (i * k + p) * kLanes);
+          Load(y, group_b + (p * n + j) * kLanes);
+          sum += x * y;
+        }
+        Store(group_out + (i * n + j) * kLanes, sum);
+      }
+    }
+  }
+}
+
+// Eliminates groups begin to end of the n x n matrices a, every lane with
+// its own pivots, which are swapped into place by lane masks. Without
+// kInverse the rows below each pivot are reduced and result receives the
+// determinants. With it, Gauss-Jordan reduces a to I while the same steps
+// take I to the inverse in out, and result receives 1 for the lanes that
+// pass the singularity test and 0 for the others. work is null up to
+// kStackOrder and otherwise as large as a.
+template <bool kInverse>
+inline __attribute__((always_inline)) void EliminateGroups(
+    const double *a, int n, double *work, double *out, double *result,
+    int begin, int end) {
+  const std::size_t size = static_cast<std::size_t>(n) * n * kLanes;
+  double stack[kStackOrder * kStackOrder * kLanes];
+  auto at = [n](double *matrix, int i, int j) {
+    return matrix + (i * n + j) * kLanes;
+  };
+  const Lane zero = {}, one = zero + 1.0;
+  for (int g = begin; g < end; g++) {
+    double *w = work != nullptr ? work + g * size : stack;
+    std::copy(a + g * size, a + (g + 1) * size, w);
+    double *x = kInverse ? out + g * size : nullptr;
+    Lane det = one, regular = one, limit = zero, value, other;
+    if (kInverse) {
+      std::fill(x, x + size, 0.0);
+      for (int i = 0; i < n; i++) Store(at(x, i, i), one);
+      for (std::size_t e = 0; e < size; e += kLanes) {
+        Load(value, w + e);
+        value = value < zero ? -value : value;
+        limit = value > limit ? value : limit;
+      }
+      limit *= S21Tolerance<double>::kValue;
+    }
+
+    for (int c = 0; c < n; c++) {
+      Lane best, pivot_row = zero + c;
+      Load(best, at(w, c, c));
+      best = best < zero ? -best : best;
+      for (int i = c + 1; i < n; i++) {
+        Load(value, at(w, i, c));
+        value = value < zero ? -value : value;
+        const auto larger = value > best;
+        best = larger ? value : best;
+        pivot_row = larger ? zero + i : pivot_row;
+      }
+      for (int i = c + 1; i < n; i++) {
+        const auto swap = pivot_row == i;
+        for (int j = kInverse ? 0 : c; j < n; j++) {
+          double *matrices[2] = {w, x};
+          for (int m = 0; m < (kInverse ? 2 : 1); m++) {
+            Load(value, at(matrices[m], c, j));
+            Load(other, at(matrices[m], i, j));
+            Store(at(matrices[m], c, j), swap ? other : value);
+            Store(at(matrices[m], i, j), swap ? value : other);
+          }
+        }
+      }
+      det = pivot_row != c ? -det : det;
+
+      Lane pivot, factor, row_value;
+      Load(pivot, at(w, c, c));
+      det *= pivot;
+      regular = best > limit ? regular : zero;
+      // A zero pivot leaves its lane unchanged rather than spreading NaNs.
+      const Lane inv_pivot = pivot == zero ? zero : one / pivot;
+      if (!kInverse) {
+        for (int i = c + 1; i < n; i++) {
+          Load(factor, at(w, i, c));
+          factor *= inv_pivot;
+          for (int j = c + 1; j < n; j++) {
+            Load(value, at(w, i, j));
+            Load(row_value, at(w, c, j));
+            Store(at(w, i, j), value - factor * row_value);
+          }
+        }
+        continue;
+      }
+      for (int j = c + 1; j < n; j++) {
+        Load(value, at(w, c, j));
+        Store(at(w, c, j), value * inv_pivot);
+      }
+      for (int j = 0; j < n; j++) {
+        Load(value, at(x, c, j));
+        Store(at(x, c, j), value * inv_pivot);
+      }
+      for (int i = 0; i < n; i++) {
+        if (i == c) continue;
+        Load(factor, at(w, i, c));
+        for (int j = c + 1; j < n; j++) {
+          Load(value, at(w, i, j));
+          Load(row_value, at(w, c, j));
+          Store(at(w, i, j), value - factor * row_value);
+        }
+        for (int j = 0; j < n; j++) {
+          Load(value, at(x, i, j));
+          Load(row_value, at(x, c, j));
+          Store(at(x, i, j), value - factor * row_value);
+        }
+      }
+    }
+    Store(result + g * kLanes, kInverse ? regular : det);
+  }
+}
+
+struct BatchKernels {
+  void (*multiply)(const double *a, const double *b, double *out, int m,
+                   int k, int n, int begin, int end);
+  void (*determinant)(const double *a, int n, double *work, double *det,
+                      int begin, int end);
+  void (*inverse)(const double *a, int n, double *work, double *out,
+                  double *regular, int begin, int end);
+};
+
+void BaseMultiply(const double *a, const double *b, double *out, int m, int k,
+                  int n, int begin, int end) {
+  MultiplyGroups(a, b, out, m, k, n, begin, end);
+}
+
+void BaseDeterminant(const double *a, int n, double *work, double *det,
+                     int begin, int end) {
+  EliminateGroups<false>(a, n, work, nullptr, det, begin, end);
+}
+
+void BaseInverse(const double *a, int n, double *work, double *out,
+                 double *regular, int begin, int end) {
+  EliminateGroups<true>(a, n, work, out, regular, begin, end);
+}
+
+#ifdef S21_SIMD_X86
+__attribute__((target("avx2,fma"))) void Avx2Multiply(
+    const double *a, const double *b, double *out, int m, int k, int n,
+    int begin, int end) {
+  MultiplyGroups(a, b, out, m, k, n, begin, end);
+}
+
+__attribute__((target("avx2,fma"))) void Avx2Determinant(
+    const double *a, int n, double *work, double *det, int begin, int end) {
+  EliminateGroups<false>(a, n, work, nullptr, det, begin, end);
+}
+
+__attribute__((target("avx2,fma"))) void Avx2Inverse(
+    const double *a, int n, double *work, double *out, double *regular,
+    int begin, int end) {
+  EliminateGroups<true>(a, n, work, out, regular, begin, end);
+}
+
+__attribute__((target("avx512f"))) void Avx512Multiply(
+    const double *a, const double *b, double *out, int m, int k, int n,
+    int begin, int end) {
+  MultiplyGroups(a, b, out, m, k, n, begin, end);
+}
+
+__attribute__((target("avx512f"))) void Avx512Determinant(
+    const double *a, int n, double *work, double *det, int begin, int end) {
+  EliminateGroups<false>(a, n, work, nullptr, det, begin, end);
+}
+
+__attribute__((target("avx512f"))) void Avx512Inverse(
+    const double *a, int n, double *work, double *out, double *regular,
+    int begin, int end) {
+  EliminateGroups<true>(a, n, work, out, regular, begin, end);
+}
+#endif  // S21_SIMD_X86
+
+// The selected S21Matrix SIMD target; kScalar and kSse2 share the baseline
+// build.
+const BatchKernels &Kernels() {
+  static const BatchKernels kBase = {BaseMultiply, BaseDeterminant,
+                                     BaseInverse};
+#ifdef S21_SIMD_X86
+  static const BatchKernels kAvx2 = {Avx2Multiply, Avx2Determinant,
+                                     Avx2Inverse};
+  static const BatchKernels kAvx512 = {Avx512Multiply, Avx512Determinant,
+                                       Avx512Inverse};
+  switch (s21::Simd().target) {
+    case S21SimdTarget::kAvx512:
+      return kAvx512;
+    case S21SimdTarget::kAvx2:
+      return kAvx2;
+    default:
+      break;
+  }
+#endif  // S21_SIMD_X86
+  return kBase;
+}
+
+// Elimination scratch for a batch of order n holding size doubles: none up
+// to kStackOrder, otherwise one buffer from the current memory resource.
+std::pmr::vector<double> Scratch(int n, std::size_t size) {
+  std::pmr::vector<double> work(S21CurrentMemoryResource());
+  if (n > kStackOrder) work.resize(size);
+  return work;
+}
+
+}  // namespace
+
+S21MatrixBatch::S21MatrixBatch()
+    : count_(0), rows_(0), cols_(0), data_(S21CurrentMemoryResource()) {}
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols)
+    : count_(count), rows_(rows), cols_(cols),
+      data_(S21CurrentMemoryResource()) {
+  if (count_ <= 0 || rows_ <= 0 || cols_ <= 0) {
+    throw std::out_of_range("Invalid matrix size");
+  }
+  data_.resize(Groups() * GroupSize());
+}
+
+S21MatrixBatch::S21MatrixBatch(const S21MatrixBatch &other)
+    : count_(other.count_),
+      rows_(other.rows_),
+      cols_(other.cols_),
+      data_(other.data_, S21CurrentMemoryResource()) {}
+
+S21MatrixBatch::S21MatrixBatch(S21MatrixBatch &&other) noexcept
+    : count_(other.count_),
+      rows_(other.rows_),
+      cols_(other.cols_),
+      data_(std::move(other.data_)) {
+  other.count_ = other.rows_ = other.cols_ = 0;
+  other.data_.clear();
+}
+
+S21Matrix S21MatrixBatch::Get(int k) const {
+  CheckIndex(k, 0, 0);
+  S21Matrix res(rows_, cols_);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) res(i, j) = data_[Offset(k, i, j)];
+  }
+  return res;
+}
+
+void S21MatrixBatch::Set(int k, const S21MatrixView &matrix) {
+  CheckIndex(k, 0, 0);
+  if (matrix.GetRows() != rows_ || matrix.GetCols() != cols_) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) data_[Offset(k, i, j)] = matrix(i, j);
+  }
+}
+
+void S21MatrixBatch::Multiply(const S21MatrixBatch &a, const S21MatrixBatch &b,
+                              S21MatrixBatch &out) {
+  if (a.count_ != b.count_ || a.cols_ != b.rows_ || a.count_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21MatrixBatch a_copy, b_copy;
+  const S21MatrixBatch *op_a = &a, *op_b = &b;
+  if (&out == &a) op_a = &(a_copy = a);
+  if (&out == &b) op_b = &(b_copy = b);
+  const int count = a.count_, m = a.rows_, k = a.cols_, n = b.cols_;
+  if (out.count_ != count || out.rows_ != m || out.cols_ != n) {
+    out = S21MatrixBatch(count, m, n);
+  }
+  const BatchKernels &kernels = Kernels();
+  s21::ParallelFor(out.Groups(), static_cast<long>(count) * m * k * n,
+                   [&](int begin, int end) {
+                     kernels.multiply(op_a->data_.data(), op_b->data_.data(),
+                                      out.data_.data(), m, k, n, begin, end);
+                   });
+}
+
+std::vector<double> S21MatrixBatch::Determinant() const {
+  CheckSquare();
+  std::vector<double> res(static_cast<std::size_t>(Groups()) * kLanes);
+  std::pmr::vector<double> work = Scratch(rows_, data_.size());
+  double *scratch = work.empty() ? nullptr : work.data();
+  const BatchKernels &kernels = Kernels();
+  const long n = rows_;
+  s21::ParallelFor(Groups(), count_ * n * n * n, [&](int begin, int end) {
+    kernels.determinant(data_.data(), rows_, scratch, res.data(), begin, end);
+  });
+  res.resize(count_);
+  return res;
+}
+
+S21MatrixBatch S21MatrixBatch::InverseMatrix() const {
+  CheckSquare();
+  S21MatrixBatch res(count_, rows_, cols_);
+  std::vector<double> regular(static_cast<std::size_t>(Groups()) * kLanes);
+  std::pmr::vector<double> work = Scratch(rows_, data_.size());
+  double *scratch = work.empty() ? nullptr : work.data();
+  const BatchKernels &kernels = Kernels();
+  const long n = rows_;
+  s21::ParallelFor(Groups(), 2 * count_ * n * n * n, [&](int begin, int end) {
+    kernels.inverse(data_.data(), rows_, scratch, res.data_.data(),
+                    regular.data(), begin, end);
+  });
+  if (std::find(regular.begin(), regular.begin() + count_, 0.0) !=
+      regular.begin() + count_) {
+    throw std::invalid_argument("Matrix determinant is 0");
+  }
+  return res;
+}
+
+S21MatrixBatch &S21MatrixBatch::operator=(S21MatrixBatch &&other) {
+  if (this != &other) {
+    count_ = other.count_;
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    data_ = std::move(other.data_);
+    other.count_ = other.rows_ = other.cols_ = 0;
+    other.data_.clear();
+  }
+  return *this;
+}
+
+double &S21MatrixBatch::operator()(int k, int i, int j) {
+  CheckIndex(k, i, j);
+  return data_[Offset(k, i, j)];
+}
+
+double S21MatrixBatch::operator()(int k, int i, int j) const {
+  CheckIndex(k, i, j);
+  return data_[Offset(k, i, j)];
+}
+
+void S21MatrixBatch::CheckIndex(int k, int i, int j) const {
+  if (k < 0 || i < 0 || j < 0 || k >= count_ || i >= rows_ || j >= cols_) {
+    throw std::out_of_range("Index outside the matrix");
+  }
+}
+
+void S21MatrixBatch::CheckSquare() const {
+  if (rows_ != cols_ || count_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+}
@@ -0,0 +1,80 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_BATCH_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_BATCH_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// GetCount() matrices of one small shape, for large batches of independent
+// 4 x 4 or 6 x 6 problems. They are stored interleaved in groups of kLanes:
+// element (i, j) of the matrices of a group is kLanes consecutive doubles,
+// so the batched operations handle a whole group per vector instruction,
+// with no per-matrix allocation, checks or exceptions, and spread the groups
+// over the thread pool. The last group is padded with zero matrices. Storage,
+// and the elimination scratch of orders above 16, comes from the current
+// S21Matrix memory resource.
+class S21MatrixBatch {
+ public:
+  // Matrices per group: one 64-byte line per element.
+  static constexpr int kLanes = 8;
+
+  S21MatrixBatch();
+  // count zero matrices of rows x cols.
+  S21MatrixBatch(int count, int rows, int cols);
+  S21MatrixBatch(const S21MatrixBatch &other);
+  S21MatrixBatch(S21MatrixBatch &&other) noexcept;
+  ~S21MatrixBatch() = default;
+
+  int GetCount() const noexcept { return count_; }
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  // Copies matrix k out of or into the batch; throw std::out_of_range for k
+  // outside it, Set std::invalid_argument on a shape mismatch.
+  S21Matrix Get(int k) const;
+  void Set(int k, const S21MatrixView &matrix);
+
+  // out[k] = a[k] * b[k] for every k. out is resized if needed and may be a
+  // or b. Throws std::invalid_argument unless the counts are equal and a's
+  // columns match b's rows.
+  static void Multiply(const S21MatrixBatch &a, const S21MatrixBatch &b,
+                       S21MatrixBatch &out);
+  // Gaussian elimination with partial pivoting, pivots chosen per matrix.
+  std::vector<double> Determinant() const;
+  // Gauss-Jordan elimination, pivoted as Determinant(). Throws
+  // std::invalid_argument if the matrices are not square or any of them has
+  // a pivot no larger than 1e-7 times its largest entry, the test
+  // S21Matrix::InverseMatrix() applies at every size.
+  S21MatrixBatch InverseMatrix() const;
+
+  S21MatrixBatch &operator=(const S21MatrixBatch &other) = default;
+  S21MatrixBatch &operator=(S21MatrixBatch &&other);
+  // Element (i, j) of matrix k.
+  double &operator()(int k, int i, int j);
+  double operator()(int k, int i, int j) const;
+
+  friend S21MatrixBatch operator*(const S21MatrixBatch &lhs,
+                                  const S21MatrixBatch &rhs) {
+    S21MatrixBatch res;
+    Multiply(lhs, rhs, res);
+    return res;
+  }
+
+ private:
+  int count_, rows_, cols_;
+  std::pmr::vector<double> data_;
+
+  int Groups() const noexcept { return (count_ + kLanes - 1) / kLanes; }
+  std::size_t GroupSize() const noexcept {
+    return static_cast<std::size_t>(rows_) * cols_ * kLanes;
+  }
+  std::size_t Offset(int k, int i, int j) const noexcept {
+    return k / kLanes * GroupSize() +
+           (static_cast<std::size_t>(i) * cols_ + j) * kLanes + k % kLanes;
+  }
+  void CheckIndex(int k, int i, int j) const;
+  void CheckSquare() const;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_BATCH_H_
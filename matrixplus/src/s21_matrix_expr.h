@@ -0,0 +1,125 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_EXPR_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_EXPR_H_
+
+#include <stdexcept>
+#include <utility>
+
+template <typename T>
+class S21BasicMatrix;
+using S21Matrix = S21BasicMatrix<double>;
+class S21MatrixView;
+
+// Base of everything that can appear in an elementwise matrix formula. The
+// binary operators build a tree of lightweight nodes that is evaluated in a
+// single fused pass once it is assigned or converted to S21Matrix. Nodes hold
+// S21Matrix operands by reference, so an expression must not outlive them.
+// Aliases(dst) reports operands that read the destination out of place (such
+// as a transposed view or a shifted block of it); those expressions are
+// evaluated into a temporary.
+template <typename E>
+class S21MatrixExpr {
+ public:
+  const E &Self() const { return static_cast<const E &>(*this); }
+};
+
+// Matrices are referenced, nested nodes are copied into their parent.
+template <typename E>
+struct S21ExprStorage {
+  using Type = const E;
+};
+
+template <>
+struct S21ExprStorage<S21Matrix> {
+  using Type = const S21Matrix &;
+};
+
+struct S21PlusOp {
+  static double Apply(double a, double b) { return a + b; }
+};
+
+struct S21MinusOp {
+  static double Apply(double a, double b) { return a - b; }
+};
+
+template <typename L, typename R, typename Op>
+class S21BinaryExpr : public S21MatrixExpr<S21BinaryExpr<L, R, Op>> {
+ public:
+  S21BinaryExpr(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {
+    if (lhs_.GetRows() != rhs_.GetRows() ||
+        lhs_.GetCols() != rhs_.GetCols() || lhs_.GetRows() == 0) {
+      throw std::invalid_argument(
+          "Invalid argument! Different matrix dimensions");
+    }
+  }
+
+  int GetRows() const { return lhs_.GetRows(); }
+  int GetCols() const { return lhs_.GetCols(); }
+
+  auto ExprRow(int i) const {
+    return RowType{lhs_.ExprRow(i), rhs_.ExprRow(i)};
+  }
+  bool Aliases(const S21MatrixView &dst) const {
+    return lhs_.Aliases(dst) || rhs_.Aliases(dst);
+  }
+
+ private:
+  using LRow = decltype(std::declval<const L &>().ExprRow(0));
+  using RRow = decltype(std::declval<const R &>().ExprRow(0));
+
+  struct RowType {
+    double operator[](int j) const { return Op::Apply(lhs[j], rhs[j]); }
+    LRow lhs;
+    RRow rhs;
+  };
+
+  typename S21ExprStorage<L>::Type lhs_;
+  typename S21ExprStorage<R>::Type rhs_;
+};
+
+template <typename E>
+class S21ScaledExpr : public S21MatrixExpr<S21ScaledExpr<E>> {
+ public:
+  S21ScaledExpr(const E &expr, double num) : expr_(expr), num_(num) {}
+
+  int GetRows() const { return expr_.GetRows(); }
+  int GetCols() const { return expr_.GetCols(); }
+
+  auto ExprRow(int i) const { return RowType{expr_.ExprRow(i), num_}; }
+  bool Aliases(const S21MatrixView &dst) const { return expr_.Aliases(dst); }
+
+ private:
+  using Row = decltype(std::declval<const E &>().ExprRow(0));
+
+  struct RowType {
+    double operator[](int j) const { return row[j] * num; }
+    Row row;
+    double num;
+  };
+
+  typename S21ExprStorage<E>::Type expr_;
+  double num_;
+};
+
+template <typename L, typename R>
+S21BinaryExpr<L, R, S21PlusOp> operator+(const S21MatrixExpr<L> &lhs,
+                                         const S21MatrixExpr<R> &rhs) {
+  return S21BinaryExpr<L, R, S21PlusOp>(lhs.Self(), rhs.Self());
+}
+
+template <typename L, typename R>
+S21BinaryExpr<L, R, S21MinusOp> operator-(const S21MatrixExpr<L> &lhs,
+                                          const S21MatrixExpr<R> &rhs) {
+  return S21BinaryExpr<L, R, S21MinusOp>(lhs.Self(), rhs.Self());
+}
+
+template <typename E>
+S21ScaledExpr<E> operator*(const S21MatrixExpr<E> &expr, double num) {
+  return S21ScaledExpr<E>(expr.Self(), num);
+}
+
+template <typename E>
+S21ScaledExpr<E> operator*(double num, const S21MatrixExpr<E> &expr) {
+  return S21ScaledExpr<E>(expr.Self(), num);
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_EXPR_H_
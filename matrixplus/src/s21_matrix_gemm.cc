@@ -0,0 +1,409 @@
+#include "s21_matrix_gemm.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_simd.h"
+#include "s21_thread_pool.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#endif
+
+namespace {
+
+constexpr long kSmallProduct = 32L * 32L * 32L;
+constexpr long kParallelProduct = 128L * 128L * 128L;
+constexpr std::size_t kBufferAlignment = 64;
+
+long CacheSize(int level, long fallback) {
+  long size = -1;
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+  if (level == 1) size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+  if (level == 2) size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (level == 3) size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#else
+  (void)level;
+#endif
+  return size > 0 ? size : fallback;
+}
+
+int RoundDown(long value, int step, int min_value, int max_value) {
+  long res = value / step * step;
+  return static_cast<int>(std::clamp<long>(res, min_value, max_value));
+}
+
+int RoundUp(int value, int step) { return (value + step - 1) / step * step; }
+
+// Register tile of a micro-kernel: kMr rows of A by kNr columns of B, each
+// row of the tile held in vectors of kBytes bytes, so a float tile has twice
+// the columns of a double one in the same registers.
+template <typename T, int kBytes, int kRows, int kCols>
+struct Tile {
+  typedef T Scalar;
+  typedef T Vec __attribute__((vector_size(kBytes)));
+  static constexpr int kLanes = kBytes / sizeof(T);
+  static constexpr int kMr = kRows;
+  static constexpr int kNr = kCols;
+};
+
+// dst = beta * dst + value, without reading dst when beta is 0.
+template <typename T>
+inline void Update(T &dst, T beta, T value) {
+  dst = beta == T(0) ? value : beta * dst + value;
+}
+
+// Keeps the kMr x kNr block of C in registers for the whole kc loop. Inlined
+// into one MicroKernel per tile, whose target the generic vectors are
+// lowered to.
+template <typename K, typename T = typename K::Scalar>
+inline __attribute__((always_inline)) void TileKernel(
+    int kc, T alpha, const T *a, const T *b, T beta, T *c, std::ptrdiff_t ldc,
+    int mr, int nr) {
+  typedef typename K::Vec Vec;
+  constexpr int kMr = K::kMr, kNr = K::kNr;
+  constexpr int kVectors = kNr / K::kLanes;
+  Vec acc[kMr][kVectors] = {};
+  for (int p = 0; p < kc; p++) {
+    Vec bv[kVectors];
+#pragma GCC unroll 8
+    for (int j = 0; j < kVectors; j++) {
+      bv[j] = *reinterpret_cast<const Vec *>(b + K::kLanes * j);
+    }
+#pragma GCC unroll 16
+    for (int i = 0; i < kMr; i++) {
+      // Broadcast: x - 0 is x for every x, so no instruction is emitted
+      // (x + 0 is not, for x = -0).
+      const Vec ai = a[i] - Vec{};
+#pragma GCC unroll 8
+      for (int j = 0; j < kVectors; j++) {
+        acc[i][j] += ai * bv[j];
+      }
+    }
+    a += kMr;
+    b += kNr;
+  }
+  T tile[kMr][kNr];
+  std::memcpy(tile, acc, sizeof(tile));
+  for (int i = 0; i < mr; i++) {
+    for (int j = 0; j < nr; j++) {
+      Update(c[i * ldc + j], beta, alpha * tile[i][j]);
+    }
+  }
+}
+
+// The tile of the baseline build: 16-byte vectors, SSE2 on x86-64. Also the
+// tile the default block sizes and SetGemmBlocking() round to.
+template <typename T>
+struct BaseTile : Tile<T, 16, 4, 64 / sizeof(T)> {
+  static void MicroKernel(int kc, T alpha, const T *a, const T *b, T beta,
+                          T *c, std::ptrdiff_t ldc, int mr, int nr) {
+    TileKernel<BaseTile>(kc, alpha, a, b, beta, c, ldc, mr, nr);
+  }
+};
+
+#ifdef S21_SIMD_X86
+// 12 accumulators in the 16 ymm registers.
+template <typename T>
+struct Avx2Tile : Tile<T, 32, 6, 64 / sizeof(T)> {
+  __attribute__((target("avx2,fma"))) static void MicroKernel(
+      int kc, T alpha, const T *a, const T *b, T beta, T *c,
+      std::ptrdiff_t ldc, int mr, int nr) {
+    TileKernel<Avx2Tile>(kc, alpha, a, b, beta, c, ldc, mr, nr);
+  }
+};
+
+// 24 accumulators in the 32 zmm registers.
+template <typename T>
+struct Avx512Tile : Tile<T, 64, 12, 128 / sizeof(T)> {
+  __attribute__((target("avx512f"))) static void MicroKernel(
+      int kc, T alpha, const T *a, const T *b, T beta, T *c,
+      std::ptrdiff_t ldc, int mr, int nr) {
+    TileKernel<Avx512Tile>(kc, alpha, a, b, beta, c, ldc, mr, nr);
+  }
+};
+#endif  // S21_SIMD_X86
+
+struct BlockingState {
+  std::atomic<int> mc, kc, nc;
+
+  // A kc x kNr sliver of B is reused from L1 by every micro-kernel call, an
+  // mc x kc block of A stays in L2 and the kc x nc panel of B lives in L3.
+  BlockingState() {
+    constexpr int kMr = BaseTile<double>::kMr, kNr = BaseTile<double>::kNr;
+    const long l1 = CacheSize(1, 32 * 1024);
+    const long l2 = CacheSize(2, 256 * 1024);
+    const long l3 = CacheSize(3, 8 * 1024 * 1024);
+    const int kc_def =
+        RoundDown(l1 / 2 / (kNr * sizeof(double)), 8, 64, 512);
+    const int mc_def =
+        RoundDown(l2 / 2 / (kc_def * sizeof(double)), kMr, kMr * 8, 1024);
+    const int nc_def =
+        RoundDown(l3 / 2 / (kc_def * sizeof(double)), kNr, kNr * 32, 4096);
+    mc.store(mc_def);
+    kc.store(kc_def);
+    nc.store(nc_def);
+  }
+};
+
+BlockingState &Blocking() {
+  static BlockingState state;
+  return state;
+}
+
+// Packed panels of A and B. Deliberately outside the memory resource: each
+// thread keeps its buffers for every later product, so they would outlive
+// the scope of an arena or pool, and they are allocated once per thread
+// rather than per product.
+template <typename T>
+class PackBuffer {
+ public:
+  PackBuffer() = default;
+  PackBuffer(const PackBuffer &) = delete;
+  PackBuffer &operator=(const PackBuffer &) = delete;
+  ~PackBuffer() {
+    if (data_ != nullptr)
+      ::operator delete(data_, std::align_val_t(kBufferAlignment));
+  }
+
+  T *Reserve(std::size_t size) {
+    if (size > size_) {
+      if (data_ != nullptr)
+        ::operator delete(data_, std::align_val_t(kBufferAlignment));
+      data_ = static_cast<T *>(::operator new(
+          size * sizeof(T), std::align_val_t(kBufferAlignment)));
+      size_ = size;
+    }
+    return data_;
+  }
+
+ private:
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+template <typename K, typename T = typename K::Scalar>
+void PackA(int mc, int kc, const T *a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+           T *dst) {
+  constexpr int kMr = K::kMr;
+  for (int ir = 0; ir < mc; ir += kMr) {
+    const int mr = std::min(kMr, mc - ir);
+    const T *src = a + ir * rsa;
+    for (int p = 0; p < kc; p++) {
+      for (int i = 0; i < kMr; i++) {
+        *dst++ = i < mr ? src[i * rsa + p * csa] : T(0);
+      }
+    }
+  }
+}
+
+template <typename K, typename T = typename K::Scalar>
+void PackB(int kc, int nc, const T *b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+           T *dst) {
+  constexpr int kNr = K::kNr;
+  for (int jr = 0; jr < nc; jr += kNr) {
+    const int nr = std::min(kNr, nc - jr);
+    const T *src = b + jr * csb;
+    for (int p = 0; p < kc; p++) {
+      for (int j = 0; j < kNr; j++) {
+        *dst++ = j < nr ? src[p * rsb + j * csb] : T(0);
+      }
+    }
+  }
+}
+
+template <typename T>
+void ScaleRows(int m, int n, T beta, T *c, std::ptrdiff_t ldc) {
+  if (beta == T(1)) return;
+  for (int i = 0; i < m; i++) {
+    T *c_row = c + i * ldc;
+    if (beta == T(0)) {
+      std::memset(c_row, 0, sizeof(T) * n);
+    } else {
+      for (int j = 0; j < n; j++) c_row[j] *= beta;
+    }
+  }
+}
+
+template <typename T>
+void SmallGemm(int m, int n, int k, T alpha, const T *a, std::ptrdiff_t rsa,
+               std::ptrdiff_t csa, const T *b, std::ptrdiff_t rsb,
+               std::ptrdiff_t csb, T beta, T *c, std::ptrdiff_t ldc) {
+  if (csb != 1 && rsb == 1 && csa == 1) {
+    // B is stored transposed: rows of A and columns of B are both
+    // contiguous, so every element of C is a unit-stride dot product.
+    for (int i = 0; i < m; i++) {
+      const T *a_row = a + i * rsa;
+      for (int j = 0; j < n; j++) {
+        const T *b_col = b + j * csb;
+        T sum = T(0);
+        for (int p = 0; p < k; p++) {
+          sum += a_row[p] * b_col[p];
+        }
+        Update(c[i * ldc + j], beta, alpha * sum);
+      }
+    }
+    return;
+  }
+  for (int i = 0; i < m; i++) {
+    T *c_row = c + i * ldc;
+    ScaleRows(1, n, beta, c_row, ldc);
+    for (int p = 0; p < k; p++) {
+      const T aip = alpha * a[i * rsa + p * csa];
+      const T *b_row = b + p * rsb;
+      for (int j = 0; j < n; j++) {
+        c_row[j] += aip * b_row[j * csb];
+      }
+    }
+  }
+}
+
+template <typename K, typename T = typename K::Scalar>
+void GemmSerial(int m, int n, int k, T alpha, const T *a, std::ptrdiff_t rsa,
+                std::ptrdiff_t csa, const T *b, std::ptrdiff_t rsb,
+                std::ptrdiff_t csb, T beta, T *c, std::ptrdiff_t ldc) {
+  if (static_cast<long>(m) * n * k <= kSmallProduct) {
+    SmallGemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+    return;
+  }
+
+  // The block sizes are tuned in doubles for the base tile. The A block and
+  // the B panel take twice as many floats; kc shrinks with wider slivers of
+  // B so a sliver keeps its size in L1.
+  constexpr int kMr = K::kMr, kNr = K::kNr;
+  constexpr int kWiden = static_cast<int>(sizeof(double) / sizeof(T));
+  constexpr int kNarrow = static_cast<int>(
+      kNr * sizeof(T) / (BaseTile<double>::kNr * sizeof(double)));
+  const int mc =
+      RoundUp(Blocking().mc.load(std::memory_order_relaxed) * kWiden, kMr);
+  const int kc =
+      std::max(1, Blocking().kc.load(std::memory_order_relaxed) / kNarrow);
+  const int nc =
+      RoundUp(Blocking().nc.load(std::memory_order_relaxed) * kWiden, kNr);
+
+  thread_local PackBuffer<T> a_buffer, b_buffer;
+  T *packed_a = a_buffer.Reserve(static_cast<std::size_t>(mc) * kc);
+  T *packed_b = b_buffer.Reserve(static_cast<std::size_t>(kc) * nc);
+
+  for (int jc = 0; jc < n; jc += nc) {
+    const int nb = std::min(nc, n - jc);
+    for (int pc = 0; pc < k; pc += kc) {
+      const int kb = std::min(kc, k - pc);
+      // Only the first pass over the k dimension applies beta.
+      const T beta_pass = pc == 0 ? beta : T(1);
+      PackB<K>(kb, nb, b + pc * rsb + jc * csb, rsb, csb, packed_b);
+      for (int ic = 0; ic < m; ic += mc) {
+        const int mb = std::min(mc, m - ic);
+        PackA<K>(mb, kb, a + ic * rsa + pc * csa, rsa, csa, packed_a);
+        for (int jr = 0; jr < nb; jr += kNr) {
+          const int nr = std::min(kNr, nb - jr);
+          for (int ir = 0; ir < mb; ir += kMr) {
+            const int mr = std::min(kMr, mb - ir);
+            K::MicroKernel(kb, alpha, packed_a + ir * kb, packed_b + jr * kb,
+                           beta_pass, c + (ic + ir) * ldc + jc + jr, ldc, mr,
+                           nr);
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename K, typename T = typename K::Scalar>
+void GemmParallel(int m, int n, int k, T alpha, const T *a,
+                  std::ptrdiff_t rsa, std::ptrdiff_t csa, const T *b,
+                  std::ptrdiff_t rsb, std::ptrdiff_t csb, T beta, T *c,
+                  std::ptrdiff_t ldc) {
+  if (m <= 0 || n <= 0) return;
+  if (k <= 0 || alpha == T(0)) {
+    ScaleRows(m, n, beta, c, ldc);
+    return;
+  }
+  if (static_cast<long>(m) * n * k < kParallelProduct) {
+    GemmSerial<K>(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+    return;
+  }
+  // Workers get whole micro-tiles of C along its longer side and pack their
+  // own slices of A and B.
+  constexpr int kMr = K::kMr, kNr = K::kNr;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  if (m >= n) {
+    pool.ParallelFor((m + kMr - 1) / kMr, [&](int begin, int end) {
+      const int row = begin * kMr;
+      const int rows = std::min(m, end * kMr) - row;
+      GemmSerial<K>(rows, n, k, alpha, a + row * rsa, rsa, csa, b, rsb, csb,
+                 beta, c + row * ldc, ldc);
+    });
+  } else {
+    pool.ParallelFor((n + kNr - 1) / kNr, [&](int begin, int end) {
+      const int col = begin * kNr;
+      const int cols = std::min(n, end * kNr) - col;
+      GemmSerial<K>(m, cols, k, alpha, a, rsa, csa, b + col * csb, rsb, csb,
+                 beta, c + col, ldc);
+    });
+  }
+}
+
+// The tile of the selected S21Matrix SIMD target; kScalar and kSse2 share
+// the baseline build.
+template <typename T>
+void GemmDispatch(int m, int n, int k, T alpha, const T *a,
+                  std::ptrdiff_t rsa, std::ptrdiff_t csa, const T *b,
+                  std::ptrdiff_t rsb, std::ptrdiff_t csb, T beta, T *c,
+                  std::ptrdiff_t ldc) {
+#ifdef S21_SIMD_X86
+  switch (s21::Simd<T>().target) {
+    case S21SimdTarget::kAvx512:
+      GemmParallel<Avx512Tile<T>>(m, n, k, alpha, a, rsa, csa, b, rsb, csb,
+                                  beta, c, ldc);
+      return;
+    case S21SimdTarget::kAvx2:
+      GemmParallel<Avx2Tile<T>>(m, n, k, alpha, a, rsa, csa, b, rsb, csb,
+                                beta, c, ldc);
+      return;
+    default:
+      break;
+  }
+#endif  // S21_SIMD_X86
+  GemmParallel<BaseTile<T>>(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c,
+                            ldc);
+}
+
+}  // namespace
+
+namespace s21 {
+
+void Gemm(int m, int n, int k, double alpha, const double *a,
+          std::ptrdiff_t rsa, std::ptrdiff_t csa, const double *b,
+          std::ptrdiff_t rsb, std::ptrdiff_t csb, double beta, double *c,
+          std::ptrdiff_t ldc) {
+  GemmDispatch(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+}
+
+void Gemm(int m, int n, int k, float alpha, const float *a,
+          std::ptrdiff_t rsa, std::ptrdiff_t csa, const float *b,
+          std::ptrdiff_t rsb, std::ptrdiff_t csb, float beta, float *c,
+          std::ptrdiff_t ldc) {
+  GemmDispatch(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+}
+
+}  // namespace s21
+
+S21GemmBlocking S21Matrix::GetGemmBlocking() {
+  return {Blocking().mc.load(), Blocking().kc.load(), Blocking().nc.load()};
+}
+
+void S21Matrix::SetGemmBlocking(const S21GemmBlocking &blocking) {
+  if (blocking.mc <= 0 || blocking.kc <= 0 || blocking.nc <= 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Block sizes must be positive");
+  }
+  Blocking().mc.store(RoundUp(blocking.mc, BaseTile<double>::kMr));
+  Blocking().kc.store(blocking.kc);
+  Blocking().nc.store(RoundUp(blocking.nc, BaseTile<double>::kNr));
+}
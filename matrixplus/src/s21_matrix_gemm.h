@@ -0,0 +1,24 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_GEMM_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_GEMM_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// C(m x n) = alpha * A(m x k) * B(k x n) + beta * C. A and B are addressed
+// through arbitrary row/column strides, C is row-major with leading dimension
+// ldc. The scaling by beta is folded into the first pass over each block of
+// C; with beta 0, C is not read, so it may hold anything.
+void Gemm(int m, int n, int k, double alpha, const double *a,
+          std::ptrdiff_t rsa, std::ptrdiff_t csa, const double *b,
+          std::ptrdiff_t rsb, std::ptrdiff_t csb, double beta, double *c,
+          std::ptrdiff_t ldc);
+// The same in single precision, for S21BasicMatrix<float>.
+void Gemm(int m, int n, int k, float alpha, const float *a,
+          std::ptrdiff_t rsa, std::ptrdiff_t csa, const float *b,
+          std::ptrdiff_t rsb, std::ptrdiff_t csb, float beta, float *c,
+          std::ptrdiff_t ldc);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_GEMM_H_
@@ -0,0 +1,423 @@
+#include "s21_matrix_lu.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "s21_matrix_gemm.h"
+
+namespace {
+
+// Width of the column panels; the trailing updates are done by Gemm.
+constexpr int kLuBlock = 64;
+
+// sum of a[k] * x[k * incx] over k < n, in four independent chains.
+template <typename T>
+T Dot(const T *a, const T *x, std::ptrdiff_t incx, int n) {
+  T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  int k = 0;
+  for (; k + 4 <= n; k += 4) {
+    s0 += a[k] * x[k * incx];
+    s1 += a[k + 1] * x[(k + 1) * incx];
+    s2 += a[k + 2] * x[(k + 2) * incx];
+    s3 += a[k + 3] * x[(k + 3) * incx];
+  }
+  for (; k < n; k++) s0 += a[k] * x[k * incx];
+  return (s0 + s1) + (s2 + s3);
+}
+
+// Triangular solves for a single right-hand side. Every step reads one row
+// of the factors contiguously, so the solve streams them once instead of
+// going through the panel updates.
+template <typename T>
+void UnitLowerSolveVector(const T *l, int n, std::ptrdiff_t ldl, T *b,
+                          std::ptrdiff_t ldb) {
+  for (int i = 1; i < n; i++) {
+    b[i * ldb] -= Dot(l + i * ldl, b, ldb, i);
+  }
+}
+
+template <typename T>
+void UpperSolveVector(const T *u, int n, std::ptrdiff_t ldu, T *b,
+                      std::ptrdiff_t ldb) {
+  for (int i = n - 1; i >= 0; i--) {
+    const T *u_row = u + i * ldu;
+    b[i * ldb] = (b[i * ldb] - Dot(u_row + i + 1, b + (i + 1) * ldb, ldb,
+                                   n - i - 1)) /
+                 u_row[i];
+  }
+}
+
+// Solves L X = B for the unit lower triangle L of l, in panels of kLuBlock
+// rows whose updates are done by Gemm.
+template <typename T>
+void UnitLowerSolve(const T *l, int n, std::ptrdiff_t ldl, T *b, int nrhs,
+                    std::ptrdiff_t ldb) {
+  if (nrhs == 1) {
+    UnitLowerSolveVector(l, n, ldl, b, ldb);
+    return;
+  }
+  for (int ib = 0; ib < n; ib += kLuBlock) {
+    const int block_end = std::min(n, ib + kLuBlock);
+    s21::Gemm(block_end - ib, nrhs, ib, T(-1), l + ib * ldl, ldl, 1, b, ldb,
+              1, T(1), b + ib * ldb, ldb);
+    for (int i = ib + 1; i < block_end; i++) {
+      const T *l_row = l + i * ldl;
+      T *x_row = b + i * ldb;
+      for (int k = ib; k < i; k++) {
+        const T value = l_row[k];
+        if (value == T(0)) continue;
+        const T *y_row = b + k * ldb;
+        for (int j = 0; j < nrhs; j++) {
+          x_row[j] -= value * y_row[j];
+        }
+      }
+    }
+  }
+}
+
+// CholeskySolve for a single right-hand side: L y = b by rows of L, then
+// L^T x = y by rows of L as well, each solved component being subtracted
+// from the ones above it.
+void CholeskySolveVector(const double *l, int n, std::ptrdiff_t ldl,
+                         double *b, std::ptrdiff_t ldb) {
+  for (int i = 0; i < n; i++) {
+    const double *l_row = l + i * ldl;
+    b[i * ldb] = (b[i * ldb] - Dot(l_row, b, ldb, i)) / l_row[i];
+  }
+  for (int i = n - 1; i >= 0; i--) {
+    const double *l_row = l + i * ldl;
+    const double x = b[i * ldb] /= l_row[i];
+    for (int k = 0; k < i; k++) b[k * ldb] -= l_row[k] * x;
+  }
+}
+
+// P A Q = L U with complete pivoting. row_swaps/col_swaps receive the swap
+// applied at every step; returns the combined sign of both permutations.
+template <typename T>
+int FullPivotLu(T *a, int n, std::ptrdiff_t lda, int *row_swaps,
+                int *col_swaps) {
+  int sign = 1;
+  for (int k = 0; k < n; k++) {
+    int pivot_row = k, pivot_col = k;
+    decltype(std::abs(T())) max_abs = 0;
+    for (int i = k; i < n; i++) {
+      for (int j = k; j < n; j++) {
+        if (std::abs(a[i * lda + j]) > max_abs) {
+          max_abs = std::abs(a[i * lda + j]);
+          pivot_row = i;
+          pivot_col = j;
+        }
+      }
+    }
+    row_swaps[k] = pivot_row;
+    col_swaps[k] = pivot_col;
+    if (pivot_row != k) {
+      std::swap_ranges(a + k * lda, a + k * lda + n, a + pivot_row * lda);
+      sign = -sign;
+    }
+    if (pivot_col != k) {
+      for (int i = 0; i < n; i++) {
+        std::swap(a[i * lda + k], a[i * lda + pivot_col]);
+      }
+      sign = -sign;
+    }
+    if (max_abs == 0) continue;
+
+    const T *u_row = a + k * lda;
+    for (int i = k + 1; i < n; i++) {
+      T *row = a + i * lda;
+      const T l = row[k] / u_row[k];
+      row[k] = l;
+      for (int j = k + 1; j < n; j++) {
+        row[j] -= l * u_row[j];
+      }
+    }
+  }
+  return sign;
+}
+
+}  // namespace
+
+namespace s21 {
+
+template <typename T>
+int LuFactor(T *a, int n, std::ptrdiff_t lda, int *perm) {
+  int sign = 1;
+  for (int kb = 0; kb < n; kb += kLuBlock) {
+    const int nb = std::min(kLuBlock, n - kb);
+    const int panel_end = kb + nb;
+
+    for (int k = kb; k < panel_end; k++) {
+      int pivot = k;
+      T max_abs = std::abs(a[k * lda + k]);
+      for (int i = k + 1; i < n; i++) {
+        const T value = std::abs(a[i * lda + k]);
+        if (value > max_abs) {
+          max_abs = value;
+          pivot = i;
+        }
+      }
+      if (perm != nullptr) perm[k] = pivot;
+      if (max_abs == T(0)) return 0;
+      if (pivot != k) {
+        std::swap_ranges(a + k * lda, a + k * lda + n, a + pivot * lda);
+        sign = -sign;
+      }
+
+      const T *u_row = a + k * lda;
+      for (int i = k + 1; i < n; i++) {
+        T *row = a + i * lda;
+        const T l = row[k] / u_row[k];
+        row[k] = l;
+        if (l == T(0)) continue;
+        for (int j = k + 1; j < panel_end; j++) {
+          row[j] -= l * u_row[j];
+        }
+      }
+    }
+
+    const int rest = n - panel_end;
+    if (rest > 0) {
+      for (int i = kb + 1; i < panel_end; i++) {
+        T *row = a + i * lda;
+        for (int k = kb; k < i; k++) {
+          const T l = row[k];
+          if (l == T(0)) continue;
+          const T *u_row = a + k * lda;
+          for (int j = panel_end; j < n; j++) {
+            row[j] -= l * u_row[j];
+          }
+        }
+      }
+      Gemm(rest, rest, nb, T(-1), a + panel_end * lda + kb, lda, 1,
+           a + kb * lda + panel_end, lda, 1, T(1),
+           a + panel_end * lda + panel_end, lda);
+    }
+  }
+  return sign;
+}
+
+template <typename T>
+void LuSolve(const T *lu, int n, std::ptrdiff_t ldlu, const int *perm, T *b,
+             int nrhs, std::ptrdiff_t ldb) {
+  for (int k = 0; k < n; k++) {
+    if (perm[k] != k) {
+      std::swap_ranges(b + k * ldb, b + k * ldb + nrhs, b + perm[k] * ldb);
+    }
+  }
+  UnitLowerSolve(lu, n, ldlu, b, nrhs, ldb);
+  UpperSolve(lu, n, ldlu, b, nrhs, ldb);
+}
+
+template <typename T>
+void UpperSolve(const T *u, int n, std::ptrdiff_t ldu, T *b, int nrhs,
+                std::ptrdiff_t ldb) {
+  if (nrhs == 1) {
+    UpperSolveVector(u, n, ldu, b, ldb);
+    return;
+  }
+  const int last_block = (n - 1) / kLuBlock * kLuBlock;
+  for (int ib = last_block; ib >= 0; ib -= kLuBlock) {
+    const int block_end = std::min(n, ib + kLuBlock);
+    Gemm(block_end - ib, nrhs, n - block_end, T(-1),
+         u + ib * ldu + block_end, ldu, 1, b + block_end * ldb, ldb, 1, T(1),
+         b + ib * ldb, ldb);
+    for (int i = block_end - 1; i >= ib; i--) {
+      const T *u_row = u + i * ldu;
+      T *x_row = b + i * ldb;
+      for (int k = i + 1; k < block_end; k++) {
+        const T value = u_row[k];
+        if (value == T(0)) continue;
+        const T *y_row = b + k * ldb;
+        for (int j = 0; j < nrhs; j++) {
+          x_row[j] -= value * y_row[j];
+        }
+      }
+      const T inv_pivot = T(1) / u_row[i];
+      for (int j = 0; j < nrhs; j++) {
+        x_row[j] *= inv_pivot;
+      }
+    }
+  }
+}
+
+bool CholeskyFactor(double *a, int n, std::ptrdiff_t lda, double min_pivot) {
+  for (int kb = 0; kb < n; kb += kLuBlock) {
+    const int nb = std::min(kLuBlock, n - kb);
+    const int panel_end = kb + nb;
+
+    // Columns kb to panel_end of L, all rows at once; the columns left of
+    // kb are already subtracted by the trailing updates.
+    for (int j = kb; j < panel_end; j++) {
+      double *l_row = a + j * lda;
+      const double pivot = l_row[j] - Dot(l_row + kb, l_row + kb, 1, j - kb);
+      if (!(pivot > min_pivot)) return false;
+      l_row[j] = sqrt(pivot);
+      const double inv_pivot = 1.0 / l_row[j];
+      for (int i = j + 1; i < n; i++) {
+        double *row = a + i * lda;
+        row[j] = (row[j] - Dot(row + kb, l_row + kb, 1, j - kb)) * inv_pivot;
+      }
+    }
+
+    // Lower triangle of A22 -= L21 * L21^T, one strip of rows at a time so
+    // only the diagonal tiles are computed past it.
+    for (int rb = panel_end; rb < n; rb += kLuBlock) {
+      const int rows = std::min(kLuBlock, n - rb);
+      Gemm(rows, rb + rows - panel_end, nb, -1.0, a + rb * lda + kb, lda, 1,
+           a + panel_end * lda + kb, 1, lda, 1.0, a + rb * lda + panel_end,
+           lda);
+    }
+  }
+  return true;
+}
+
+void CholeskySolve(const double *l, int n, std::ptrdiff_t ldl, double *b,
+                   int nrhs, std::ptrdiff_t ldb) {
+  if (nrhs == 1) {
+    CholeskySolveVector(l, n, ldl, b, ldb);
+    return;
+  }
+  for (int ib = 0; ib < n; ib += kLuBlock) {
+    const int block_end = std::min(n, ib + kLuBlock);
+    Gemm(block_end - ib, nrhs, ib, -1.0, l + ib * ldl, ldl, 1, b, ldb, 1, 1.0,
+         b + ib * ldb, ldb);
+    for (int i = ib; i < block_end; i++) {
+      const double *l_row = l + i * ldl;
+      double *x_row = b + i * ldb;
+      for (int k = ib; k < i; k++) {
+        const double *y_row = b + k * ldb;
+        for (int j = 0; j < nrhs; j++) {
+          x_row[j] -= l_row[k] * y_row[j];
+        }
+      }
+      const double inv_pivot = 1.0 / l_row[i];
+      for (int j = 0; j < nrhs; j++) {
+        x_row[j] *= inv_pivot;
+      }
+    }
+  }
+
+  // L^T is read through swapped strides.
+  const int last_block = (n - 1) / kLuBlock * kLuBlock;
+  for (int ib = last_block; ib >= 0; ib -= kLuBlock) {
+    const int block_end = std::min(n, ib + kLuBlock);
+    Gemm(block_end - ib, nrhs, n - block_end, -1.0, l + block_end * ldl + ib,
+         1, ldl, b + block_end * ldb, ldb, 1, 1.0, b + ib * ldb, ldb);
+    for (int i = block_end - 1; i >= ib; i--) {
+      double *x_row = b + i * ldb;
+      const double inv_pivot = 1.0 / l[i * ldl + i];
+      for (int j = 0; j < nrhs; j++) {
+        x_row[j] *= inv_pivot;
+      }
+      for (int k = ib; k < i; k++) {
+        const double u = l[i * ldl + k];
+        double *y_row = b + k * ldb;
+        for (int j = 0; j < nrhs; j++) {
+          y_row[j] -= u * x_row[j];
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+void Adjugate(T *a, int n, std::ptrdiff_t lda, T *adj, std::ptrdiff_t ldadj) {
+  for (int i = 0; i < n; i++) {
+    std::fill(adj + i * ldadj, adj + i * ldadj + n, T(0));
+  }
+  if (n == 1) {
+    adj[0] = T(1);
+    return;
+  }
+  std::vector<int> row_swaps(n), col_swaps(n);
+  const int sign = FullPivotLu(a, n, lda, row_swaps.data(), col_swaps.data());
+  const int m = n - 1;
+  T minor_det = T(1);
+  for (int k = 0; k < m; k++) {
+    minor_det *= a[k * lda + k];
+  }
+  // Pivots never grow, so a zero before the last one means rank(A) < n - 1
+  // and adj(A) = 0.
+  if (minor_det == T(0)) return;
+
+  // adj(U) = [det(U11) u_nn U11^-1, -det(U11) U11^-1 u; 0, det(U11)].
+  for (int c = 0; c < m; c++) {
+    adj[c * ldadj + c] = T(1) / a[c * lda + c];
+    for (int i = c - 1; i >= 0; i--) {
+      T sum = T(0);
+      for (int k = i + 1; k <= c; k++) {
+        sum += a[i * lda + k] * adj[k * ldadj + c];
+      }
+      adj[i * ldadj + c] = -sum / a[i * lda + i];
+    }
+  }
+  for (int i = 0; i < m; i++) {
+    T sum = T(0);
+    for (int k = i; k < m; k++) {
+      sum += adj[i * ldadj + k] * a[k * lda + m];
+    }
+    adj[i * ldadj + m] = -minor_det * sum;
+    for (int k = i; k < m; k++) {
+      adj[i * ldadj + k] *= minor_det * a[m * lda + m];
+    }
+  }
+  adj[m * ldadj + m] = minor_det;
+
+  // adj(A) = det(P) det(Q) Q adj(U) L^-1 P.
+  for (int r = 0; r < n; r++) {
+    T *x = adj + r * ldadj;
+    for (int k = m; k > 0; k--) {
+      const T *l_row = a + k * lda;
+      for (int j = 0; j < k; j++) {
+        x[j] -= x[k] * l_row[j];
+      }
+    }
+  }
+  for (int k = m; k >= 0; k--) {
+    if (row_swaps[k] == k) continue;
+    for (int r = 0; r < n; r++) {
+      std::swap(adj[r * ldadj + k], adj[r * ldadj + row_swaps[k]]);
+    }
+  }
+  for (int k = m; k >= 0; k--) {
+    if (col_swaps[k] == k) continue;
+    std::swap_ranges(adj + k * ldadj, adj + k * ldadj + n,
+                     adj + col_swaps[k] * ldadj);
+  }
+  if (sign < 0) {
+    for (int r = 0; r < n; r++) {
+      for (int j = 0; j < n; j++) {
+        adj[r * ldadj + j] = -adj[r * ldadj + j];
+      }
+    }
+  }
+}
+
+template int LuFactor(double *, int, std::ptrdiff_t, int *);
+template int LuFactor(float *, int, std::ptrdiff_t, int *);
+template void LuSolve(const double *, int, std::ptrdiff_t, const int *,
+                      double *, int, std::ptrdiff_t);
+template void LuSolve(const float *, int, std::ptrdiff_t, const int *,
+                      float *, int, std::ptrdiff_t);
+template void UpperSolve(const double *, int, std::ptrdiff_t, double *, int,
+                         std::ptrdiff_t);
+template void UpperSolve(const float *, int, std::ptrdiff_t, float *, int,
+                         std::ptrdiff_t);
+template void Adjugate(double *, int, std::ptrdiff_t, double *,
+                       std::ptrdiff_t);
+template void Adjugate(float *, int, std::ptrdiff_t, float *, std::ptrdiff_t);
+template void Adjugate(long double *, int, std::ptrdiff_t, long double *,
+                       std::ptrdiff_t);
+template void Adjugate(std::complex<float> *, int, std::ptrdiff_t,
+                       std::complex<float> *, std::ptrdiff_t);
+template void Adjugate(std::complex<double> *, int, std::ptrdiff_t,
+                       std::complex<double> *, std::ptrdiff_t);
+template void Adjugate(std::complex<long double> *, int, std::ptrdiff_t,
+                       std::complex<long double> *, std::ptrdiff_t);
+
+}  // namespace s21
@@ -0,0 +1,52 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_LU_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_LU_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// The templates below are defined for T double and float, the element types
+// Gemm handles.
+
+// In-place LU factorization with partial pivoting of the n x n row-major
+// matrix a: on return the strict lower triangle holds L (unit diagonal) and
+// the upper triangle holds U. perm (optional, n entries) receives the row
+// taken as pivot at every step. Returns the sign of the row permutation, or
+// 0 if a pivot column is exactly zero (the matrix is singular).
+template <typename T>
+int LuFactor(T *a, int n, std::ptrdiff_t lda, int *perm);
+
+// Overwrites the n x nrhs row-major block b with the solution X of A X = B,
+// where lu and perm come from a successful LuFactor of A.
+template <typename T>
+void LuSolve(const T *lu, int n, std::ptrdiff_t ldlu, const int *perm, T *b,
+             int nrhs, std::ptrdiff_t ldb);
+
+// Overwrites the n x nrhs row-major block b with the solution X of U X = B
+// for the upper triangle U of u; the strict lower triangle is not read.
+template <typename T>
+void UpperSolve(const T *u, int n, std::ptrdiff_t ldu, T *b, int nrhs,
+                std::ptrdiff_t ldb);
+
+// In-place Cholesky factorization A = L L^T of the symmetric positive
+// definite n x n row-major matrix a, of which only the lower triangle is
+// read. On return the lower triangle holds L; the strict upper triangle is
+// left undefined. Returns false, with a partly overwritten, as soon as a
+// pivot is not above min_pivot (A is not positive definite).
+bool CholeskyFactor(double *a, int n, std::ptrdiff_t lda, double min_pivot);
+
+// Overwrites the n x nrhs row-major block b with the solution X of
+// L L^T X = B, where l comes from a successful CholeskyFactor.
+void CholeskySolve(const double *l, int n, std::ptrdiff_t ldl, double *b,
+                   int nrhs, std::ptrdiff_t ldb);
+
+// Writes adj(A) of the n x n matrix a into adj, destroying a. Uses LU with
+// complete pivoting and never divides by the last pivot, so it also works
+// for singular A. Besides double and float, also defined for long double
+// and std::complex of all three, for S21BasicMatrix::CalcComplements.
+template <typename T>
+void Adjugate(T *a, int n, std::ptrdiff_t lda, T *adj, std::ptrdiff_t ldadj);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_LU_H_
@@ -3,37 +3,103 @@
 
 #include <math.h>
 
+#include <cstddef>
 #include <iostream>
+#include <vector>
 
-const double eps = 1e-07;
+#include "s21_basic_matrix.h"
+#include "s21_matrix_expr.h"
+#include "s21_matrix_view.h"
+#include "s21_memory_resource.h"
+#include "s21_thread_pool.h"
 
-class S21Matrix {
+// Kept for existing callers; the library compares through S21Tolerance.
+const double eps = S21Tolerance<double>::kValue;
+
+struct S21GemmBlocking {
+  int mc, kc, nc;
+};
+
+enum class S21SimdTarget { kScalar, kSse2, kAvx2, kAvx512 };
+
+enum class S21Transpose { kNone, kTranspose };
+
+// S21Matrix is S21BasicMatrix<double>: the same interface as the generic
+// template, plus expression templates and the tuned kernels.
+template <>
+class S21BasicMatrix<double> : public S21MatrixExpr<S21Matrix> {
  public:
-  S21Matrix();
-  S21Matrix(int rows, int cols);
-  S21Matrix(const S21Matrix &other);
-  S21Matrix(S21Matrix &&other) noexcept;
-  ~S21Matrix();
+  S21BasicMatrix();
+  S21BasicMatrix(int rows, int cols);
+  S21BasicMatrix(const S21Matrix &other);
+  S21BasicMatrix(S21Matrix &&other) noexcept;
+  template <typename E>
+  S21BasicMatrix(const S21MatrixExpr<E> &expr);
+  ~S21BasicMatrix();
 
   bool EqMatrix(const S21Matrix &other) const noexcept;
   void SumMatrix(const S21Matrix &other);
+  void SumMatrix(const S21MatrixView &other);
   void SubMatrix(const S21Matrix &other);
+  void SubMatrix(const S21MatrixView &other);
   void MulNumber(const double num);
   void MulMatrix(const S21Matrix &other);
-  S21Matrix Transpose();
-  S21Matrix CalcComplements();
-  double Determinant();
-  S21Matrix InverseMatrix();
-
-  S21Matrix operator+(const S21Matrix &other);
-  S21Matrix operator-(const S21Matrix &other);
-  S21Matrix operator*(const S21Matrix &other);
-  S21Matrix operator*(const double num);
-  friend S21Matrix operator*(double num, S21Matrix &other);
+  void MulMatrix(const S21MatrixView &other);
+  // Matrices convert to views implicitly; out may overlap a or b.
+  static void Multiply(const S21MatrixView &a, const S21MatrixView &b,
+                       S21Matrix &out);
+  // c = alpha * op(a) * op(b) + beta * c in one pass over c, op() reading
+  // its operand transposed when asked to, without copying it. With beta 0,
+  // c is not read and is resized to the product if needed; otherwise it
+  // must already have the product's shape. c may overlap a or b.
+  static void Gemm(S21Transpose trans_a, S21Transpose trans_b, double alpha,
+                   const S21MatrixView &a, const S21MatrixView &b,
+                   double beta, S21Matrix &c);
+  static void Gemm(S21Transpose trans_a, S21Transpose trans_b, double alpha,
+                   const S21MatrixView &a, const S21MatrixView &b,
+                   double beta, S21MatrixBlock c);
+  // c = alpha * op(a) * op(a)^T + beta * c, op() as in Gemm. Only the lower
+  // triangle is computed, strip by strip, and then mirrored, which takes
+  // about half the flops of the general product. Only the lower triangle of
+  // c is read; beta 0 and overlaps are handled as in Gemm.
+  static void Syrk(S21Transpose trans, double alpha, const S21MatrixView &a,
+                   double beta, S21Matrix &c);
+  S21Matrix Transpose() const;
+  // Transposes without allocating when the matrix is square; other shapes
+  // change the row padding and go through Transpose().
+  void TransposeInPlace();
+  // O(1) transposed view of this matrix, valid while the matrix is.
+  S21MatrixView TransposedView() const;
+  // rows x cols window whose top-left element is (row, col), sharing this
+  // matrix's storage; throws std::out_of_range unless it lies inside. Valid
+  // until the matrix is resized or destroyed.
+  S21MatrixBlock Block(int row, int col, int rows, int cols);
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  S21Matrix CalcComplements() const;
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  // X with this * X = b, by LU with partial pivoting, without forming the
+  // inverse. b may have any number of columns. Throws std::invalid_argument
+  // on a shape mismatch or a singular matrix. To solve against the same
+  // matrix repeatedly, build an S21LuFactorization once instead.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  // X minimizing the 2-norm of a * X - b column by column, for a with at
+  // least as many rows as columns, through Householder QR; see
+  // S21QrFactorization, which also keeps the factors for reuse.
+  static S21Matrix LeastSquares(const S21MatrixView &a,
+                                const S21MatrixView &b);
+
   S21Matrix &operator=(const S21Matrix &other);
+  S21Matrix &operator=(S21Matrix &&other) noexcept;
+  template <typename E>
+  S21Matrix &operator=(const S21MatrixExpr<E> &expr);
   bool operator==(const S21Matrix &other) const;
   S21Matrix &operator+=(const S21Matrix &other);
+  template <typename E>
+  S21Matrix &operator+=(const S21MatrixExpr<E> &expr);
   S21Matrix &operator-=(const S21Matrix &other);
+  template <typename E>
+  S21Matrix &operator-=(const S21MatrixExpr<E> &expr);
   S21Matrix &operator*=(const S21Matrix &other);
   S21Matrix &operator*=(const double num);
   double &operator()(const int i, const int j);
@@ -41,15 +107,271 @@ class S21Matrix {
 
   void SetRows(const int rows);
   void SetCols(const int cols);
-  int GetRows();
-  int GetCols();
+  int GetRows() const;
+  int GetCols() const;
+
+  static int GetThreadCount();
+  static void SetThreadCount(const int threads);
+  static std::pmr::memory_resource *GetMemoryResource();
+  static std::pmr::memory_resource *SetMemoryResource(
+      std::pmr::memory_resource *resource);
+  static S21MemoryResource &DefaultMemoryResource();
+  // GEMM block sizes, in doubles for the SSE2 tile. The AVX2 and AVX-512
+  // tiles, picked by the SIMD target, round them to their own tile and
+  // shrink kc in proportion to their wider slivers of B.
+  static S21GemmBlocking GetGemmBlocking();
+  static void SetGemmBlocking(const S21GemmBlocking &blocking);
+  // Products whose dimensions all exceed the crossover use Strassen-Winograd;
+  // 0 (the default) keeps every product classical.
+  static int GetStrassenCrossover();
+  static void SetStrassenCrossover(const int crossover);
+  // Bound on max|C - fl(A * B)| / (max|A| * max|B|) for size x size products
+  // at the current crossover, to first order in the unit roundoff u (Higham,
+  // Accuracy and Stability of Numerical Algorithms, 2nd ed., Thm. 23.3):
+  // (18^l * (n0^2 + 6 n0) - 6 n0 * 2^l) u for l levels down to blocks of
+  // n0. The classical product has n^2 u, so every level costs roughly a
+  // factor of 18 / 4 in accuracy.
+  static double StrassenErrorBound(const int size);
+  static S21SimdTarget GetSimdTarget();
+  static void SetSimdTarget(const S21SimdTarget target);
+  static bool SimdSupported(const S21SimdTarget target);
 
  private:
-  int rows_, cols_;
-  double **matrix_;
-  void CreateMatrix();
+  template <typename L, typename R, typename Op>
+  friend class S21BinaryExpr;
+  template <typename E>
+  friend class S21ScaledExpr;
+  friend class S21MatrixView;
+  friend class S21MatrixBlock;
+  friend class S21LuFactorization;
+  friend class S21CholeskyFactorization;
+  friend class S21QrFactorization;
+
+  static constexpr std::size_t kAlignment = 64;
+
+  int rows_, cols_, ld_;
+  double *matrix_;
+  std::pmr::memory_resource *resource_;
+  // Allocates storage for rows_ x cols_; with zero false only the padding
+  // past each row is cleared.
+  void CreateMatrix(bool zero = true);
+  // rows x cols matrix whose elements the caller overwrites.
+  static S21Matrix Uninitialized(int rows, int cols);
+  void FreeMatrix() noexcept;
+  double *Row(int i) noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(i) * ld_;
+  }
+  const double *Row(int i) const noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(i) * ld_;
+  }
+  long Size() const noexcept { return static_cast<long>(rows_) * cols_; }
+  std::size_t Bytes() const noexcept {
+    return sizeof(double) * static_cast<std::size_t>(rows_) * ld_;
+  }
+  const double *ExprRow(int i) const noexcept { return Row(i); }
+  bool Aliases(const S21MatrixView &dst) const noexcept {
+    return S21MatrixView(*this).Aliases(dst);
+  }
+  template <typename E, typename Func>
+  void EvalExpr(const E &expr, Func func);
+  template <typename E>
+  void CheckExpr(const E &expr) const;
+  void Swap(S21Matrix &other) noexcept;
   bool CheckMatrix(const S21Matrix &other) const;
-  S21Matrix MinorMatrix(const int x, const int y);
+  S21Matrix SmallInverse() const;
+  // Stores a * b in out, which must already have the product's shape and
+  // must not overlap a or b.
+  static void Product(const S21MatrixView &a, const S21MatrixView &b,
+                      S21Matrix &out);
+  // Copies this square matrix into lu and factors it; false when a pivot is
+  // negligible next to the largest element.
+  bool FactorLu(S21Matrix &lu, std::vector<int> &perm, int &sign) const;
 };
 
+template <typename E>
+S21Matrix::S21BasicMatrix(const S21MatrixExpr<E> &expr)
+    : S21Matrix(expr.Self().GetRows(), expr.Self().GetCols()) {
+  EvalExpr(expr.Self(), [](double &dst, double src) { dst = src; });
+}
+
+template <typename E>
+S21Matrix &S21Matrix::operator=(const S21MatrixExpr<E> &expr) {
+  const E &e = expr.Self();
+  if (rows_ == e.GetRows() && cols_ == e.GetCols() && !e.Aliases(*this)) {
+    EvalExpr(e, [](double &dst, double src) { dst = src; });
+  } else {
+    S21Matrix temp_matrix(expr);
+    Swap(temp_matrix);
+  }
+  return *this;
+}
+
+template <typename E>
+S21Matrix &S21Matrix::operator+=(const S21MatrixExpr<E> &expr) {
+  CheckExpr(expr.Self());
+  if (expr.Self().Aliases(*this)) return *this += S21Matrix(expr);
+  EvalExpr(expr.Self(), [](double &dst, double src) { dst += src; });
+  return *this;
+}
+
+template <typename E>
+S21Matrix &S21Matrix::operator-=(const S21MatrixExpr<E> &expr) {
+  CheckExpr(expr.Self());
+  if (expr.Self().Aliases(*this)) return *this -= S21Matrix(expr);
+  EvalExpr(expr.Self(), [](double &dst, double src) { dst -= src; });
+  return *this;
+}
+
+template <typename E, typename Func>
+void S21Matrix::EvalExpr(const E &expr, Func func) {
+  s21::ParallelFor(rows_, Size(), [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      const auto src = expr.ExprRow(i);
+      double *dst = Row(i);
+      for (int j = 0; j < cols_; j++) {
+        func(dst[j], src[j]);
+      }
+    }
+  });
+}
+
+template <typename E>
+void S21Matrix::CheckExpr(const E &expr) const {
+  if (rows_ != expr.GetRows() || cols_ != expr.GetCols() ||
+      matrix_ == nullptr) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+}
+
+template <typename E>
+S21MatrixBlock &S21MatrixBlock::operator=(const S21MatrixExpr<E> &expr) {
+  const E &e = expr.Self();
+  if (e.Aliases(*this)) return *this = S21Matrix(expr);
+  EvalExpr(e, [](double &dst, double src) { dst = src; });
+  return *this;
+}
+
+template <typename E>
+S21MatrixBlock &S21MatrixBlock::operator+=(const S21MatrixExpr<E> &expr) {
+  const E &e = expr.Self();
+  if (e.Aliases(*this)) return *this += S21Matrix(expr);
+  EvalExpr(e, [](double &dst, double src) { dst += src; });
+  return *this;
+}
+
+template <typename E>
+S21MatrixBlock &S21MatrixBlock::operator-=(const S21MatrixExpr<E> &expr) {
+  const E &e = expr.Self();
+  if (e.Aliases(*this)) return *this -= S21Matrix(expr);
+  EvalExpr(e, [](double &dst, double src) { dst -= src; });
+  return *this;
+}
+
+template <typename E, typename Func>
+void S21MatrixBlock::EvalExpr(const E &expr, Func func) const {
+  if (GetRows() != expr.GetRows() || GetCols() != expr.GetCols()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  const long size = static_cast<long>(GetRows()) * GetCols();
+  s21::ParallelFor(GetRows(), size, [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      const auto src = expr.ExprRow(i);
+      double *dst = Data() + Offset(i, 0);
+      for (int j = 0; j < GetCols(); j++) {
+        func(dst[j * GetColStride()], src[j]);
+      }
+    }
+  });
+}
+
+inline const S21Matrix &S21Evaluate(const S21Matrix &matrix) {
+  return matrix;
+}
+
+template <typename E>
+S21Matrix S21Evaluate(const S21MatrixExpr<E> &expr) {
+  return S21Matrix(expr);
+}
+
+// Product operands: matrices and views go to the kernel as they are, other
+// expressions are evaluated first.
+inline S21MatrixView S21ProductOperand(const S21Matrix &matrix) {
+  return matrix;
+}
+
+inline S21MatrixView S21ProductOperand(const S21MatrixView &view) {
+  return view;
+}
+
+template <typename E>
+S21Matrix S21ProductOperand(const S21MatrixExpr<E> &expr) {
+  return S21Matrix(expr);
+}
+
+template <typename L, typename R>
+S21Matrix operator*(const S21MatrixExpr<L> &lhs, const S21MatrixExpr<R> &rhs) {
+  S21Matrix res;
+  S21Matrix::Multiply(S21ProductOperand(lhs.Self()),
+                      S21ProductOperand(rhs.Self()), res);
+  return res;
+}
+
+// Overloads for an expiring S21Matrix operand: the result is computed in its
+// buffer and moved out, so no new matrix is allocated.
+template <typename R>
+S21Matrix operator+(S21Matrix &&lhs, const S21MatrixExpr<R> &rhs) {
+  lhs += rhs.Self();
+  return std::move(lhs);
+}
+
+template <typename L>
+S21Matrix operator+(const S21MatrixExpr<L> &lhs, S21Matrix &&rhs) {
+  rhs += lhs.Self();
+  return std::move(rhs);
+}
+
+inline S21Matrix operator+(S21Matrix &&lhs, S21Matrix &&rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template <typename R>
+S21Matrix operator-(S21Matrix &&lhs, const S21MatrixExpr<R> &rhs) {
+  lhs -= rhs.Self();
+  return std::move(lhs);
+}
+
+template <typename L>
+S21Matrix operator-(const S21MatrixExpr<L> &lhs, S21Matrix &&rhs) {
+  rhs = lhs.Self() - rhs;
+  return std::move(rhs);
+}
+
+inline S21Matrix operator-(S21Matrix &&lhs, S21Matrix &&rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+inline S21Matrix operator*(S21Matrix &&matrix, double num) {
+  matrix *= num;
+  return std::move(matrix);
+}
+
+inline S21Matrix operator*(double num, S21Matrix &&matrix) {
+  matrix *= num;
+  return std::move(matrix);
+}
+
+template <typename L, typename R>
+bool operator==(const S21MatrixExpr<L> &lhs, const S21MatrixExpr<R> &rhs) {
+  return S21Evaluate(lhs.Self()).EqMatrix(S21Evaluate(rhs.Self()));
+}
+
+template <typename R>
+bool operator==(const S21Matrix &lhs, const S21MatrixExpr<R> &rhs) {
+  return lhs.EqMatrix(S21Evaluate(rhs.Self()));
+}
+
 #endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_OOP_H_
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "s21_matrix_qr.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "s21_matrix_gemm.h"
+
+namespace {
+
+// Widest panel factored column by column; wider ones are split in two.
+// Column-by-column passes are bandwidth bound, so the leaves are kept
+// narrow: a kQrBlock panel ends in leaves of 4 columns.
+constexpr int kQrLeaf = 6;
+
+// Householder QR of the r x w panel a, w <= kQrBlock, w <= r, and its T
+// factor.
+// Each column takes one pass over the rows, which applies the reflector to
+// the rest of the panel and, on the way, gathers what the next column and T
+// need: the squared norm of the next column below its diagonal, its dot
+// products with the columns right of it, and V^T v_j for the previous
+// Householder vectors.
+void PanelFactor(double *a, int r, int w, std::ptrdiff_t lda, double *t,
+                 std::ptrdiff_t ldt) {
+  double acc[s21::kQrBlock], tw[s21::kQrBlock], y[s21::kQrBlock];
+  double norm_sq = 0.0;
+  std::fill(acc, acc + w, 0.0);
+  for (int i = 1; i < r; i++) {
+    const double *row = a + i * lda;
+    norm_sq += row[0] * row[0];
+    for (int c = 1; c < w; c++) acc[c] += row[0] * row[c];
+  }
+
+  for (int j = 0; j < w; j++) {
+    double *head = a + j * lda;
+    const double alpha = head[j];
+    double beta = alpha, tau = 0.0, scale = 0.0;
+    if (norm_sq != 0.0) {
+      beta = -copysign(sqrt(alpha * alpha + norm_sq), alpha);
+      tau = (beta - alpha) / beta;
+      scale = 1.0 / (alpha - beta);
+    }
+    head[j] = beta;
+    for (int c = j + 1; c < w; c++) {
+      tw[c] = tau * (head[c] + scale * acc[c]);
+      head[c] -= tw[c];
+    }
+    std::copy(head, head + j, y);
+
+    const bool next = j + 1 < w;
+    norm_sq = 0.0;
+    std::fill(acc, acc + w, 0.0);
+    for (int i = j + 1; i < r; i++) {
+      double *row = a + i * lda;
+      const double v = row[j] * scale;
+      row[j] = v;
+      for (int p = 0; p < j; p++) y[p] += row[p] * v;
+      for (int c = j + 1; c < w; c++) row[c] -= v * tw[c];
+      if (next && i > j + 1) {
+        const double x = row[j + 1];
+        norm_sq += x * x;
+        for (int c = j + 2; c < w; c++) acc[c] += x * row[c];
+      }
+    }
+
+    // T(0:j, j) = -tau T(0:j, 0:j) V(:, 0:j)^T v_j.
+    for (int p = 0; p < j; p++) {
+      double sum = 0.0;
+      for (int q = p; q < j; q++) sum += t[p * ldt + q] * y[q];
+      t[p * ldt + j] = -tau * sum;
+    }
+    t[j * ldt + j] = tau;
+  }
+}
+
+// C = (I - V T V^T)^T C (transpose) or (I - V T V^T) C for the r x nc block
+// c, with V the r x w unit lower trapezoid stored below the diagonal of v.
+// work holds w x nc doubles. The triangular top of V is handled here, the
+// rectangle under it by Gemm.
+void ApplyBlock(const double *v, int r, int w, std::ptrdiff_t ldv,
+                const double *t, std::ptrdiff_t ldt, bool transpose,
+                double *c, int nc, std::ptrdiff_t ldc, double *work) {
+  // W = V^T C.
+  for (int p = 0; p < w; p++) {
+    double *w_row = work + p * nc;
+    std::copy(c + p * ldc, c + p * ldc + nc, w_row);
+    for (int l = p + 1; l < w; l++) {
+      const double value = v[l * ldv + p];
+      const double *c_row = c + l * ldc;
+      for (int j = 0; j < nc; j++) w_row[j] += value * c_row[j];
+    }
+  }
+  if (r > w) {
+    s21::Gemm(w, nc, r - w, 1.0, v + w * ldv, 1, ldv, c + w * ldc, ldc, 1,
+              1.0, work, nc);
+  }
+
+  // W = T^T W or T W, in place: each row only needs rows not yet replaced.
+  if (transpose) {
+    for (int i = w - 1; i >= 0; i--) {
+      double *w_row = work + i * nc;
+      for (int j = 0; j < nc; j++) w_row[j] *= t[i * ldt + i];
+      for (int p = 0; p < i; p++) {
+        const double value = t[p * ldt + i];
+        const double *p_row = work + p * nc;
+        for (int j = 0; j < nc; j++) w_row[j] += value * p_row[j];
+      }
+    }
+  } else {
+    for (int i = 0; i < w; i++) {
+      double *w_row = work + i * nc;
+      for (int j = 0; j < nc; j++) w_row[j] *= t[i * ldt + i];
+      for (int p = i + 1; p < w; p++) {
+        const double value = t[i * ldt + p];
+        const double *p_row = work + p * nc;
+        for (int j = 0; j < nc; j++) w_row[j] += value * p_row[j];
+      }
+    }
+  }
+
+  // C -= V W.
+  if (r > w) {
+    s21::Gemm(r - w, nc, w, -1.0, v + w * ldv, ldv, 1, work, nc, 1, 1.0,
+              c + w * ldc, ldc);
+  }
+  for (int l = 0; l < w; l++) {
+    double *c_row = c + l * ldc;
+    const double *w_row = work + l * nc;
+    for (int j = 0; j < nc; j++) c_row[j] -= w_row[j];
+    for (int p = 0; p < l; p++) {
+      const double value = v[l * ldv + p];
+      const double *p_row = work + p * nc;
+      for (int j = 0; j < nc; j++) c_row[j] -= value * p_row[j];
+    }
+  }
+}
+
+// PanelFactor for panels of up to kQrBlock columns: the left half is factored
+// and applied to the right half as a block, then the right half is factored,
+// so all but the kQrLeaf-wide leaves go through Gemm. The T factors of the
+// halves are joined by T12 = -T1 (V1^T V2) T2.
+void RecursiveFactor(double *a, int r, int w, std::ptrdiff_t lda, double *t,
+                     std::ptrdiff_t ldt) {
+  if (w <= kQrLeaf) {
+    PanelFactor(a, r, w, lda, t, ldt);
+    return;
+  }
+  const int w1 = w / 2, w2 = w - w1;
+  double work[s21::kQrBlock * s21::kQrBlock];
+  RecursiveFactor(a, r, w1, lda, t, ldt);
+  ApplyBlock(a, r, w1, lda, t, ldt, true, a + w1, w2, lda, work);
+  double *a2 = a + w1 * lda + w1;
+  RecursiveFactor(a2, r - w1, w2, lda, t + w1 * ldt + w1, ldt);
+
+  // work = V1^T V2; V2 is zero above row w1 and unit lower in its top w2
+  // rows.
+  for (int p = 0; p < w1; p++) {
+    for (int q = 0; q < w2; q++) {
+      double sum = a[(w1 + q) * lda + p];
+      for (int l = q + 1; l < w2; l++) {
+        sum += a[(w1 + l) * lda + p] * a2[l * lda + q];
+      }
+      work[p * w2 + q] = sum;
+    }
+  }
+  if (r - w1 > w2) {
+    s21::Gemm(w1, w2, r - w1 - w2, 1.0, a + (w1 + w2) * lda, 1, lda,
+              a2 + w2 * lda, lda, 1, 1.0, work, w2);
+  }
+  // work = work T2 from the right, then T12 = -T1 work.
+  const double *t2 = t + w1 * ldt + w1;
+  for (int p = 0; p < w1; p++) {
+    double *row = work + p * w2;
+    for (int q = w2 - 1; q >= 0; q--) {
+      double sum = 0.0;
+      for (int s = 0; s <= q; s++) sum += row[s] * t2[s * ldt + q];
+      row[q] = sum;
+    }
+  }
+  for (int p = 0; p < w1; p++) {
+    for (int q = 0; q < w2; q++) {
+      double sum = 0.0;
+      for (int s = p; s < w1; s++) sum += t[p * ldt + s] * work[s * w2 + q];
+      t[p * ldt + w1 + q] = -sum;
+    }
+  }
+}
+
+}  // namespace
+
+namespace s21 {
+
+void QrFactor(double *a, int m, int n, std::ptrdiff_t lda, double *t) {
+  std::vector<double> work;
+  for (int kb = 0; kb < n; kb += kQrBlock) {
+    const int w = std::min(kQrBlock, n - kb);
+    double *panel = a + kb * lda + kb;
+    double *panel_t = t + kb * kQrBlock;
+    RecursiveFactor(panel, m - kb, w, lda, panel_t, kQrBlock);
+    const int rest = n - kb - w;
+    if (rest > 0) {
+      work.resize(static_cast<std::size_t>(w) * rest);
+      ApplyBlock(panel, m - kb, w, lda, panel_t, kQrBlock, true, panel + w,
+                 rest, lda, work.data());
+    }
+  }
+}
+
+void QrMultiply(const double *qr, int m, int n, std::ptrdiff_t ldqr,
+                const double *t, bool transpose, double *b, int nrhs,
+                std::ptrdiff_t ldb) {
+  std::vector<double> work(static_cast<std::size_t>(kQrBlock) * nrhs);
+  const int panels = (n + kQrBlock - 1) / kQrBlock;
+  for (int step = 0; step < panels; step++) {
+    // Q = Q_0 Q_1 ... applies its last panel first; Q^T its first.
+    const int kb = (transpose ? step : panels - 1 - step) * kQrBlock;
+    const int w = std::min(kQrBlock, n - kb);
+    ApplyBlock(qr + kb * ldqr + kb, m - kb, w, ldqr, t + kb * kQrBlock,
+               kQrBlock, transpose, b + kb * ldb, nrhs, ldb, work.data());
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,28 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_QR_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_QR_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// Columns per panel of QrFactor. The reflectors of a panel are applied
+// together as I - V T V^T (compact WY), with a kQrBlock x kQrBlock upper
+// triangular T per panel.
+constexpr int kQrBlock = 32;
+
+// In-place Householder QR of the m x n row-major matrix a, m >= n: on return
+// the upper triangle holds R and column j below the diagonal holds the
+// Householder vector v_j, whose leading 1 is implied. t (n x kQrBlock,
+// row-major) receives the T factors: the panel starting at column kb keeps
+// its factor in rows kb to kb + kQrBlock, with tau_j on the diagonal.
+void QrFactor(double *a, int m, int n, std::ptrdiff_t lda, double *t);
+
+// Overwrites the m x nrhs row-major block b with Q^T B (transpose) or Q B,
+// where qr and t come from QrFactor.
+void QrMultiply(const double *qr, int m, int n, std::ptrdiff_t ldqr,
+                const double *t, bool transpose, double *b, int nrhs,
+                std::ptrdiff_t ldb);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_QR_H_
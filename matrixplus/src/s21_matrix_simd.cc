@@ -0,0 +1,631 @@
+#include "s21_matrix_simd.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "s21_matrix_oop.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+template <typename T>
+void ScalarAdd(T *a, const T *b, int n) {
+  for (int j = 0; j < n; j++) {
+    a[j] += b[j];
+  }
+}
+
+template <typename T>
+void ScalarSub(T *a, const T *b, int n) {
+  for (int j = 0; j < n; j++) {
+    a[j] -= b[j];
+  }
+}
+
+template <typename T>
+void ScalarScale(T *a, T num, int n) {
+  for (int j = 0; j < n; j++) {
+    a[j] *= num;
+  }
+}
+
+template <typename T>
+bool ScalarEqual(const T *a, const T *b, int n, T tolerance) {
+  for (int j = 0; j < n; j++) {
+    if (std::abs(a[j] - b[j]) > tolerance) return false;
+  }
+  return true;
+}
+
+template <typename T>
+void ScalarTranspose(const T *src, std::ptrdiff_t lds, T *dst,
+                     std::ptrdiff_t ldd, int rows, int cols) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      dst[i * ldd + j] = src[j * lds + i];
+    }
+  }
+}
+
+// Fills the part of the rows x cols block not covered by the vector kernel,
+// which handled the leading rows_done x cols_done corner.
+template <typename T>
+void TransposeEdges(const T *src, std::ptrdiff_t lds, T *dst,
+                    std::ptrdiff_t ldd, int rows, int cols, int rows_done,
+                    int cols_done) {
+  for (int i = 0; i < rows_done; i++) {
+    for (int j = cols_done; j < cols; j++) {
+      dst[i * ldd + j] = src[j * lds + i];
+    }
+  }
+  ScalarTranspose(src + rows_done, lds, dst + rows_done * ldd, ldd,
+                  rows - rows_done, cols);
+}
+
+#ifdef S21_SIMD_X86
+
+// The vector operations of one target on one element type, so each kernel
+// below is written once for double and float.
+template <typename T>
+struct Sse2Ops;
+
+template <>
+struct Sse2Ops<double> {
+  typedef __m128d Vec;
+  static constexpr int kWidth = 2;
+  static __attribute__((target("sse2"))) Vec Load(const double *p) {
+    return _mm_loadu_pd(p);
+  }
+  static __attribute__((target("sse2"))) void Store(double *p, Vec v) {
+    _mm_storeu_pd(p, v);
+  }
+  static __attribute__((target("sse2"))) Vec Set(double x) {
+    return _mm_set1_pd(x);
+  }
+  static __attribute__((target("sse2"))) Vec Add(Vec a, Vec b) {
+    return _mm_add_pd(a, b);
+  }
+  static __attribute__((target("sse2"))) Vec Sub(Vec a, Vec b) {
+    return _mm_sub_pd(a, b);
+  }
+  static __attribute__((target("sse2"))) Vec Mul(Vec a, Vec b) {
+    return _mm_mul_pd(a, b);
+  }
+  // True when |diff| > limit in some lane.
+  static __attribute__((target("sse2"))) bool Above(Vec diff, Vec limit) {
+    const Vec abs = _mm_andnot_pd(_mm_set1_pd(-0.0), diff);
+    return _mm_movemask_pd(_mm_cmpgt_pd(abs, limit)) != 0;
+  }
+};
+
+template <>
+struct Sse2Ops<float> {
+  typedef __m128 Vec;
+  static constexpr int kWidth = 4;
+  static __attribute__((target("sse2"))) Vec Load(const float *p) {
+    return _mm_loadu_ps(p);
+  }
+  static __attribute__((target("sse2"))) void Store(float *p, Vec v) {
+    _mm_storeu_ps(p, v);
+  }
+  static __attribute__((target("sse2"))) Vec Set(float x) {
+    return _mm_set1_ps(x);
+  }
+  static __attribute__((target("sse2"))) Vec Add(Vec a, Vec b) {
+    return _mm_add_ps(a, b);
+  }
+  static __attribute__((target("sse2"))) Vec Sub(Vec a, Vec b) {
+    return _mm_sub_ps(a, b);
+  }
+  static __attribute__((target("sse2"))) Vec Mul(Vec a, Vec b) {
+    return _mm_mul_ps(a, b);
+  }
+  static __attribute__((target("sse2"))) bool Above(Vec diff, Vec limit) {
+    const Vec abs = _mm_andnot_ps(_mm_set1_ps(-0.0f), diff);
+    return _mm_movemask_ps(_mm_cmpgt_ps(abs, limit)) != 0;
+  }
+};
+
+template <typename T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<double> {
+  typedef __m256d Vec;
+  static constexpr int kWidth = 4;
+  static __attribute__((target("avx2,fma"))) Vec Load(const double *p) {
+    return _mm256_loadu_pd(p);
+  }
+  static __attribute__((target("avx2,fma"))) void Store(double *p, Vec v) {
+    _mm256_storeu_pd(p, v);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Set(double x) {
+    return _mm256_set1_pd(x);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Add(Vec a, Vec b) {
+    return _mm256_add_pd(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Sub(Vec a, Vec b) {
+    return _mm256_sub_pd(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Mul(Vec a, Vec b) {
+    return _mm256_mul_pd(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) bool Above(Vec diff, Vec limit) {
+    const Vec abs = _mm256_andnot_pd(_mm256_set1_pd(-0.0), diff);
+    return _mm256_movemask_pd(_mm256_cmp_pd(abs, limit, _CMP_GT_OQ)) != 0;
+  }
+};
+
+template <>
+struct Avx2Ops<float> {
+  typedef __m256 Vec;
+  static constexpr int kWidth = 8;
+  static __attribute__((target("avx2,fma"))) Vec Load(const float *p) {
+    return _mm256_loadu_ps(p);
+  }
+  static __attribute__((target("avx2,fma"))) void Store(float *p, Vec v) {
+    _mm256_storeu_ps(p, v);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Set(float x) {
+    return _mm256_set1_ps(x);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Add(Vec a, Vec b) {
+    return _mm256_add_ps(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Sub(Vec a, Vec b) {
+    return _mm256_sub_ps(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) Vec Mul(Vec a, Vec b) {
+    return _mm256_mul_ps(a, b);
+  }
+  static __attribute__((target("avx2,fma"))) bool Above(Vec diff, Vec limit) {
+    const Vec abs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), diff);
+    return _mm256_movemask_ps(_mm256_cmp_ps(abs, limit, _CMP_GT_OQ)) != 0;
+  }
+};
+
+// The AVX-512 kernels finish the row with one masked operation instead of a
+// scalar loop.
+template <typename T>
+struct Avx512Ops;
+
+template <>
+struct Avx512Ops<double> {
+  typedef __m512d Vec;
+  typedef __mmask8 Mask;
+  static constexpr int kWidth = 8;
+  static __attribute__((target("avx512f"))) Mask Tail(int count) {
+    return static_cast<Mask>((1u << count) - 1);
+  }
+  static __attribute__((target("avx512f"))) Vec Load(const double *p) {
+    return _mm512_loadu_pd(p);
+  }
+  static __attribute__((target("avx512f"))) Vec Load(Mask mask,
+                                                     const double *p) {
+    return _mm512_maskz_loadu_pd(mask, p);
+  }
+  static __attribute__((target("avx512f"))) void Store(double *p, Vec v) {
+    _mm512_storeu_pd(p, v);
+  }
+  static __attribute__((target("avx512f"))) void Store(double *p, Mask mask,
+                                                       Vec v) {
+    _mm512_mask_storeu_pd(p, mask, v);
+  }
+  static __attribute__((target("avx512f"))) Vec Set(double x) {
+    return _mm512_set1_pd(x);
+  }
+  static __attribute__((target("avx512f"))) Vec Add(Vec a, Vec b) {
+    return _mm512_add_pd(a, b);
+  }
+  static __attribute__((target("avx512f"))) Vec Sub(Vec a, Vec b) {
+    return _mm512_sub_pd(a, b);
+  }
+  static __attribute__((target("avx512f"))) Vec Mul(Vec a, Vec b) {
+    return _mm512_mul_pd(a, b);
+  }
+  static __attribute__((target("avx512f"))) bool Above(Mask mask, Vec diff,
+                                                       Vec limit) {
+    return _mm512_mask_cmp_pd_mask(mask, _mm512_abs_pd(diff), limit,
+                                   _CMP_GT_OQ) != 0;
+  }
+};
+
+template <>
+struct Avx512Ops<float> {
+  typedef __m512 Vec;
+  typedef __mmask16 Mask;
+  static constexpr int kWidth = 16;
+  static __attribute__((target("avx512f"))) Mask Tail(int count) {
+    return static_cast<Mask>((1u << count) - 1);
+  }
+  static __attribute__((target("avx512f"))) Vec Load(const float *p) {
+    return _mm512_loadu_ps(p);
+  }
+  static __attribute__((target("avx512f"))) Vec Load(Mask mask,
+                                                     const float *p) {
+    return _mm512_maskz_loadu_ps(mask, p);
+  }
+  static __attribute__((target("avx512f"))) void Store(float *p, Vec v) {
+    _mm512_storeu_ps(p, v);
+  }
+  static __attribute__((target("avx512f"))) void Store(float *p, Mask mask,
+                                                       Vec v) {
+    _mm512_mask_storeu_ps(p, mask, v);
+  }
+  static __attribute__((target("avx512f"))) Vec Set(float x) {
+    return _mm512_set1_ps(x);
+  }
+  static __attribute__((target("avx512f"))) Vec Add(Vec a, Vec b) {
+    return _mm512_add_ps(a, b);
+  }
+  static __attribute__((target("avx512f"))) Vec Sub(Vec a, Vec b) {
+    return _mm512_sub_ps(a, b);
+  }
+  static __attribute__((target("avx512f"))) Vec Mul(Vec a, Vec b) {
+    return _mm512_mul_ps(a, b);
+  }
+  static __attribute__((target("avx512f"))) bool Above(Mask mask, Vec diff,
+                                                       Vec limit) {
+    return _mm512_mask_cmp_ps_mask(mask, _mm512_abs_ps(diff), limit,
+                                   _CMP_GT_OQ) != 0;
+  }
+};
+
+template <typename T>
+__attribute__((target("sse2"))) void Sse2Add(T *a, const T *b, int n) {
+  typedef Sse2Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Add(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  ScalarAdd(a + j, b + j, n - j);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) void Sse2Sub(T *a, const T *b, int n) {
+  typedef Sse2Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Sub(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  ScalarSub(a + j, b + j, n - j);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) void Sse2Scale(T *a, T num, int n) {
+  typedef Sse2Ops<T> Ops;
+  const typename Ops::Vec factor = Ops::Set(num);
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Mul(Ops::Load(a + j), factor));
+  }
+  ScalarScale(a + j, num, n - j);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) bool Sse2Equal(const T *a, const T *b, int n,
+                                               T tolerance) {
+  typedef Sse2Ops<T> Ops;
+  const typename Ops::Vec limit = Ops::Set(tolerance);
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    if (Ops::Above(Ops::Sub(Ops::Load(a + j), Ops::Load(b + j)), limit)) {
+      return false;
+    }
+  }
+  return ScalarEqual(a + j, b + j, n - j, tolerance);
+}
+
+__attribute__((target("sse2"))) void Sse2Transpose(const double *src,
+                                                   std::ptrdiff_t lds,
+                                                   double *dst,
+                                                   std::ptrdiff_t ldd,
+                                                   int rows, int cols) {
+  const int rows_done = rows / 2 * 2, cols_done = cols / 2 * 2;
+  for (int i = 0; i < rows_done; i += 2) {
+    for (int j = 0; j < cols_done; j += 2) {
+      const __m128d r0 = _mm_loadu_pd(src + j * lds + i);
+      const __m128d r1 = _mm_loadu_pd(src + (j + 1) * lds + i);
+      _mm_storeu_pd(dst + i * ldd + j, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(dst + (i + 1) * ldd + j, _mm_unpackhi_pd(r0, r1));
+    }
+  }
+  TransposeEdges(src, lds, dst, ldd, rows, cols, rows_done, cols_done);
+}
+
+// Floats go through 4 x 4 blocks, transposed in registers by the shuffles of
+// _MM_TRANSPOSE4_PS.
+__attribute__((target("sse2"))) void Sse2Transpose(const float *src,
+                                                   std::ptrdiff_t lds,
+                                                   float *dst,
+                                                   std::ptrdiff_t ldd,
+                                                   int rows, int cols) {
+  const int rows_done = rows / 4 * 4, cols_done = cols / 4 * 4;
+  for (int i = 0; i < rows_done; i += 4) {
+    for (int j = 0; j < cols_done; j += 4) {
+      const float *s = src + j * lds + i;
+      __m128 r0 = _mm_loadu_ps(s);
+      __m128 r1 = _mm_loadu_ps(s + lds);
+      __m128 r2 = _mm_loadu_ps(s + 2 * lds);
+      __m128 r3 = _mm_loadu_ps(s + 3 * lds);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      float *d = dst + i * ldd + j;
+      _mm_storeu_ps(d, r0);
+      _mm_storeu_ps(d + ldd, r1);
+      _mm_storeu_ps(d + 2 * ldd, r2);
+      _mm_storeu_ps(d + 3 * ldd, r3);
+    }
+  }
+  TransposeEdges(src, lds, dst, ldd, rows, cols, rows_done, cols_done);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma"))) void Avx2Add(T *a, const T *b, int n) {
+  typedef Avx2Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Add(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  ScalarAdd(a + j, b + j, n - j);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma"))) void Avx2Sub(T *a, const T *b, int n) {
+  typedef Avx2Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Sub(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  ScalarSub(a + j, b + j, n - j);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma"))) void Avx2Scale(T *a, T num, int n) {
+  typedef Avx2Ops<T> Ops;
+  const typename Ops::Vec factor = Ops::Set(num);
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Mul(Ops::Load(a + j), factor));
+  }
+  ScalarScale(a + j, num, n - j);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma"))) bool Avx2Equal(const T *a, const T *b,
+                                                   int n, T tolerance) {
+  typedef Avx2Ops<T> Ops;
+  const typename Ops::Vec limit = Ops::Set(tolerance);
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    if (Ops::Above(Ops::Sub(Ops::Load(a + j), Ops::Load(b + j)), limit)) {
+      return false;
+    }
+  }
+  return ScalarEqual(a + j, b + j, n - j, tolerance);
+}
+
+// 4 x 4 blocks are transposed in registers: unpack pairs rows, the 128-bit
+// permutes then exchange the crossing halves.
+__attribute__((target("avx2,fma"))) void Avx2Transpose(const double *src,
+                                                       std::ptrdiff_t lds,
+                                                       double *dst,
+                                                       std::ptrdiff_t ldd,
+                                                       int rows, int cols) {
+  const int rows_done = rows / 4 * 4, cols_done = cols / 4 * 4;
+  for (int i = 0; i < rows_done; i += 4) {
+    for (int j = 0; j < cols_done; j += 4) {
+      const double *s = src + j * lds + i;
+      const __m256d r0 = _mm256_loadu_pd(s);
+      const __m256d r1 = _mm256_loadu_pd(s + lds);
+      const __m256d r2 = _mm256_loadu_pd(s + 2 * lds);
+      const __m256d r3 = _mm256_loadu_pd(s + 3 * lds);
+      const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+      const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+      const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+      const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+      double *d = dst + i * ldd + j;
+      _mm256_storeu_pd(d, _mm256_permute2f128_pd(t0, t2, 0x20));
+      _mm256_storeu_pd(d + ldd, _mm256_permute2f128_pd(t1, t3, 0x20));
+      _mm256_storeu_pd(d + 2 * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+      _mm256_storeu_pd(d + 3 * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+  }
+  TransposeEdges(src, lds, dst, ldd, rows, cols, rows_done, cols_done);
+}
+
+// Floats keep the 4 x 4 blocks: an 8 x 8 block in AVX registers would need
+// more shuffles per element.
+__attribute__((target("avx2,fma"))) void Avx2Transpose(const float *src,
+                                                       std::ptrdiff_t lds,
+                                                       float *dst,
+                                                       std::ptrdiff_t ldd,
+                                                       int rows, int cols) {
+  Sse2Transpose(src, lds, dst, ldd, rows, cols);
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) void Avx512Add(T *a, const T *b, int n) {
+  typedef Avx512Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Add(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  if (j < n) {
+    const typename Ops::Mask mask = Ops::Tail(n - j);
+    Ops::Store(a + j, mask,
+               Ops::Add(Ops::Load(mask, a + j), Ops::Load(mask, b + j)));
+  }
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) void Avx512Sub(T *a, const T *b, int n) {
+  typedef Avx512Ops<T> Ops;
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Sub(Ops::Load(a + j), Ops::Load(b + j)));
+  }
+  if (j < n) {
+    const typename Ops::Mask mask = Ops::Tail(n - j);
+    Ops::Store(a + j, mask,
+               Ops::Sub(Ops::Load(mask, a + j), Ops::Load(mask, b + j)));
+  }
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) void Avx512Scale(T *a, T num, int n) {
+  typedef Avx512Ops<T> Ops;
+  const typename Ops::Vec factor = Ops::Set(num);
+  int j = 0;
+  for (; j + Ops::kWidth <= n; j += Ops::kWidth) {
+    Ops::Store(a + j, Ops::Mul(Ops::Load(a + j), factor));
+  }
+  if (j < n) {
+    const typename Ops::Mask mask = Ops::Tail(n - j);
+    Ops::Store(a + j, mask, Ops::Mul(Ops::Load(mask, a + j), factor));
+  }
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) bool Avx512Equal(const T *a, const T *b,
+                                                    int n, T tolerance) {
+  typedef Avx512Ops<T> Ops;
+  const typename Ops::Vec limit = Ops::Set(tolerance);
+  for (int j = 0; j < n; j += Ops::kWidth) {
+    const typename Ops::Mask mask = n - j >= Ops::kWidth
+                                        ? static_cast<typename Ops::Mask>(~0u)
+                                        : Ops::Tail(n - j);
+    const typename Ops::Vec diff =
+        Ops::Sub(Ops::Load(mask, a + j), Ops::Load(mask, b + j));
+    if (Ops::Above(mask, diff, limit)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+const s21::BasicSimdKernels<T> kSse2Kernels = {
+    S21SimdTarget::kSse2, Sse2Add<T>,   Sse2Sub<T>,
+    Sse2Scale<T>,         Sse2Equal<T>, Sse2Transpose};
+template <typename T>
+const s21::BasicSimdKernels<T> kAvx2Kernels = {
+    S21SimdTarget::kAvx2, Avx2Add<T>,   Avx2Sub<T>,
+    Avx2Scale<T>,         Avx2Equal<T>, Avx2Transpose};
+// An 8 x 8 register transpose would need twice the shuffles per element of
+// the 4 x 4 one, so AVX-512 keeps the AVX2 transpose.
+template <typename T>
+const s21::BasicSimdKernels<T> kAvx512Kernels = {
+    S21SimdTarget::kAvx512, Avx512Add<T>,   Avx512Sub<T>,
+    Avx512Scale<T>,         Avx512Equal<T>, Avx2Transpose};
+
+#endif  // S21_SIMD_X86
+
+template <typename T>
+const s21::BasicSimdKernels<T> kScalarKernels = {
+    S21SimdTarget::kScalar, ScalarAdd<T>,   ScalarSub<T>,
+    ScalarScale<T>,         ScalarEqual<T>, ScalarTranspose<T>};
+
+template <typename T>
+const s21::BasicSimdKernels<T> *KernelsOf(S21SimdTarget target) {
+  if (!s21::SimdSupported(target)) return nullptr;
+  switch (target) {
+#ifdef S21_SIMD_X86
+    case S21SimdTarget::kSse2:
+      return &kSse2Kernels<T>;
+    case S21SimdTarget::kAvx2:
+      return &kAvx2Kernels<T>;
+    case S21SimdTarget::kAvx512:
+      return &kAvx512Kernels<T>;
+#endif
+    default:
+      return &kScalarKernels<T>;
+  }
+}
+
+S21SimdTarget DefaultTarget() {
+  const char *env = std::getenv("S21_MATRIX_SIMD");
+  if (env != nullptr) {
+    const char *names[] = {"scalar", "sse2", "avx2", "avx512"};
+    for (int i = 0; i < 4; i++) {
+      const S21SimdTarget target = static_cast<S21SimdTarget>(i);
+      if (std::strcmp(env, names[i]) == 0 && s21::SimdSupported(target)) {
+        return target;
+      }
+    }
+  }
+  for (S21SimdTarget target : {S21SimdTarget::kAvx512, S21SimdTarget::kAvx2,
+                               S21SimdTarget::kSse2}) {
+    if (s21::SimdSupported(target)) return target;
+  }
+  return S21SimdTarget::kScalar;
+}
+
+template <typename T>
+std::atomic<const s21::BasicSimdKernels<T> *> &Selected() {
+  static std::atomic<const s21::BasicSimdKernels<T> *> kernels(
+      KernelsOf<T>(DefaultTarget()));
+  return kernels;
+}
+
+}  // namespace
+
+namespace s21 {
+
+bool SimdSupported(S21SimdTarget target) {
+  switch (target) {
+    case S21SimdTarget::kScalar:
+      return true;
+#ifdef S21_SIMD_X86
+    case S21SimdTarget::kSse2:
+      return __builtin_cpu_supports("sse2");
+    case S21SimdTarget::kAvx2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case S21SimdTarget::kAvx512:
+      return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+const BasicSimdKernels<T> &Simd() {
+  return *Selected<T>().load();
+}
+
+template <typename T>
+const BasicSimdKernels<T> &SimdKernelsFor(S21SimdTarget target) {
+  const BasicSimdKernels<T> *kernels = KernelsOf<T>(target);
+  if (kernels == nullptr) {
+    throw std::invalid_argument(
+        "Invalid argument! SIMD target is not supported");
+  }
+  return *kernels;
+}
+
+template const BasicSimdKernels<double> &Simd<double>();
+template const BasicSimdKernels<float> &Simd<float>();
+template const BasicSimdKernels<double> &SimdKernelsFor<double>(
+    S21SimdTarget);
+template const BasicSimdKernels<float> &SimdKernelsFor<float>(
+    S21SimdTarget);
+
+}  // namespace s21
+
+S21SimdTarget S21Matrix::GetSimdTarget() { return s21::Simd().target; }
+
+void S21Matrix::SetSimdTarget(const S21SimdTarget target) {
+  const s21::SimdKernels &kernels = s21::SimdKernelsFor<double>(target);
+  Selected<float>().store(&s21::SimdKernelsFor<float>(target));
+  Selected<double>().store(&kernels);
+}
+
+bool S21Matrix::SimdSupported(const S21SimdTarget target) {
+  return s21::SimdSupported(target);
+}
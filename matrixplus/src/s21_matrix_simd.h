@@ -0,0 +1,51 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SIMD_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SIMD_H_
+
+#include <cstddef>
+
+enum class S21SimdTarget;
+
+namespace s21 {
+
+// Row kernels behind the elementwise matrix operations, for T double
+// (S21Matrix) or float (S21BasicMatrix<float>). Every entry handles any
+// length n, the tail past the last full vector included, and makes no
+// alignment assumptions.
+template <typename T>
+struct BasicSimdKernels {
+  S21SimdTarget target;
+  void (*add)(T *a, const T *b, int n);
+  void (*sub)(T *a, const T *b, int n);
+  void (*scale)(T *a, T num, int n);
+  // True when |a[j] - b[j]| <= tolerance for every j.
+  bool (*equal)(const T *a, const T *b, int n, T tolerance);
+  // dst[i * ldd + j] = src[j * lds + i] for i < rows, j < cols.
+  void (*transpose)(const T *src, std::ptrdiff_t lds, T *dst,
+                    std::ptrdiff_t ldd, int rows, int cols);
+};
+
+typedef BasicSimdKernels<double> SimdKernels;
+
+bool SimdSupported(S21SimdTarget target);
+
+// Kernels selected at startup: the widest target the CPU supports, unless the
+// S21_MATRIX_SIMD environment variable names another supported one. Both
+// element types follow S21Matrix::SetSimdTarget.
+template <typename T = double>
+const BasicSimdKernels<T> &Simd();
+
+// Kernels of a given target; throws std::invalid_argument if the CPU does not
+// support it.
+template <typename T = double>
+const BasicSimdKernels<T> &SimdKernelsFor(S21SimdTarget target);
+
+// dst = src^T for the rows x cols matrix src: halves the longer side until
+// the blocks fit the cache, transposes them with the Simd<T>() kernel and
+// spreads the columns of src over the thread pool.
+template <typename T>
+void Transpose(const T *src, std::ptrdiff_t lds, T *dst, std::ptrdiff_t ldd,
+               int rows, int cols);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SIMD_H_
@@ -0,0 +1,105 @@
+#include "s21_matrix_small.h"
+
+namespace {
+
+typedef double Vec4 __attribute__((vector_size(32)));
+
+double Det2(double a, double b, double c, double d) { return a * d - b * c; }
+
+double Adjugate3(const double *r0, const double *r1, const double *r2,
+                 double *adj, std::ptrdiff_t ldadj) {
+  double *out0 = adj, *out1 = adj + ldadj, *out2 = adj + 2 * ldadj;
+  out0[0] = Det2(r1[1], r1[2], r2[1], r2[2]);
+  out0[1] = -Det2(r0[1], r0[2], r2[1], r2[2]);
+  out0[2] = Det2(r0[1], r0[2], r1[1], r1[2]);
+  out1[0] = -Det2(r1[0], r1[2], r2[0], r2[2]);
+  out1[1] = Det2(r0[0], r0[2], r2[0], r2[2]);
+  out1[2] = -Det2(r0[0], r0[2], r1[0], r1[2]);
+  out2[0] = Det2(r1[0], r1[1], r2[0], r2[1]);
+  out2[1] = -Det2(r0[0], r0[1], r2[0], r2[1]);
+  out2[2] = Det2(r0[0], r0[1], r1[0], r1[1]);
+  return r0[0] * out0[0] + r0[1] * out1[0] + r0[2] * out2[0];
+}
+
+// Splits the 4 x 4 matrix into its top and bottom row pairs: s[k] are the
+// 2 x 2 minors of rows 0-1 and c[k] the complementary minors of rows 2-3,
+// so det(A) is their signed pairwise sum (Laplace along two rows). Every row
+// of adj(A) is then three 4-wide multiply-adds.
+double Adjugate4(const double *r0, const double *r1, const double *r2,
+                 const double *r3, double *adj, std::ptrdiff_t ldadj) {
+  const double s0 = Det2(r0[0], r0[1], r1[0], r1[1]);
+  const double s1 = Det2(r0[0], r0[2], r1[0], r1[2]);
+  const double s2 = Det2(r0[0], r0[3], r1[0], r1[3]);
+  const double s3 = Det2(r0[1], r0[2], r1[1], r1[2]);
+  const double s4 = Det2(r0[1], r0[3], r1[1], r1[3]);
+  const double s5 = Det2(r0[2], r0[3], r1[2], r1[3]);
+  const double c0 = Det2(r2[0], r2[1], r3[0], r3[1]);
+  const double c1 = Det2(r2[0], r2[2], r3[0], r3[2]);
+  const double c2 = Det2(r2[0], r2[3], r3[0], r3[3]);
+  const double c3 = Det2(r2[1], r2[2], r3[1], r3[2]);
+  const double c4 = Det2(r2[1], r2[3], r3[1], r3[3]);
+  const double c5 = Det2(r2[2], r2[3], r3[2], r3[3]);
+
+  const Vec4 k0 = {c0, c0, s0, s0}, k1 = {c1, c1, s1, s1};
+  const Vec4 k2 = {c2, c2, s2, s2}, k3 = {c3, c3, s3, s3};
+  const Vec4 k4 = {c4, c4, s4, s4}, k5 = {c5, c5, s5, s5};
+  Vec4 x[4];
+  for (int j = 0; j < 4; j++) {
+    x[j] = Vec4{r1[j], -r0[j], r3[j], -r2[j]};
+  }
+  const Vec4 rows[4] = {x[1] * k5 - x[2] * k4 + x[3] * k3,
+                        x[2] * k2 - x[0] * k5 - x[3] * k1,
+                        x[0] * k4 - x[1] * k2 + x[3] * k0,
+                        x[1] * k1 - x[0] * k3 - x[2] * k0};
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      adj[i * ldadj + j] = rows[i][j];
+    }
+  }
+  return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+}  // namespace
+
+namespace s21 {
+
+double SmallDeterminant(const double *a, std::ptrdiff_t lda, int n) {
+  if (n < 3) {
+    if (n < 1) return 0.0;
+    return n == 1 ? a[0] : Det2(a[0], a[1], a[lda], a[lda + 1]);
+  }
+  const double *r0 = a, *r1 = a + lda, *r2 = a + 2 * lda;
+  if (n == 3) {
+    return r0[0] * Det2(r1[1], r1[2], r2[1], r2[2]) -
+           r0[1] * Det2(r1[0], r1[2], r2[0], r2[2]) +
+           r0[2] * Det2(r1[0], r1[1], r2[0], r2[1]);
+  }
+  const double *r3 = a + 3 * lda;
+  return Det2(r0[0], r0[1], r1[0], r1[1]) * Det2(r2[2], r2[3], r3[2], r3[3]) -
+         Det2(r0[0], r0[2], r1[0], r1[2]) * Det2(r2[1], r2[3], r3[1], r3[3]) +
+         Det2(r0[0], r0[3], r1[0], r1[3]) * Det2(r2[1], r2[2], r3[1], r3[2]) +
+         Det2(r0[1], r0[2], r1[1], r1[2]) * Det2(r2[0], r2[3], r3[0], r3[3]) -
+         Det2(r0[1], r0[3], r1[1], r1[3]) * Det2(r2[0], r2[2], r3[0], r3[2]) +
+         Det2(r0[2], r0[3], r1[2], r1[3]) * Det2(r2[0], r2[1], r3[0], r3[1]);
+}
+
+double SmallAdjugate(const double *a, std::ptrdiff_t lda, int n, double *adj,
+                     std::ptrdiff_t ldadj) {
+  if (n < 1) {
+    return 0.0;
+  } else if (n == 1) {
+    adj[0] = 1.0;
+    return a[0];
+  } else if (n == 2) {
+    adj[0] = a[lda + 1];
+    adj[1] = -a[1];
+    adj[ldadj] = -a[lda];
+    adj[ldadj + 1] = a[0];
+    return Det2(a[0], a[1], a[lda], a[lda + 1]);
+  } else if (n == 3) {
+    return Adjugate3(a, a + lda, a + 2 * lda, adj, ldadj);
+  }
+  return Adjugate4(a, a + lda, a + 2 * lda, a + 3 * lda, adj, ldadj);
+}
+
+}  // namespace s21
@@ -0,0 +1,23 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SMALL_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SMALL_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// Largest order handled by the closed-form routines below.
+constexpr int kSmallMaxSize = 4;
+
+// Determinant of the n x n row-major matrix a, n <= kSmallMaxSize, expanded
+// in cofactors without temporaries. Exact for small integer entries; 0 for
+// n = 0.
+double SmallDeterminant(const double *a, std::ptrdiff_t lda, int n);
+
+// Writes adj(A) of the n x n matrix a, n <= kSmallMaxSize, into adj and
+// returns det(A), computed from the same cofactors.
+double SmallAdjugate(const double *a, std::ptrdiff_t lda, int n, double *adj,
+                     std::ptrdiff_t ldadj);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_SMALL_H_
@@ -0,0 +1,180 @@
+#include "s21_matrix_strassen.h"
+
+#include <math.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_oop.h"
+#include "s21_memory_resource.h"
+
+namespace {
+
+std::atomic<int> crossover_size{0};
+
+// Row-major view of one quadrant of a matrix.
+struct Block {
+  double *data;
+  std::ptrdiff_t ld;
+};
+
+struct ConstBlock {
+  const double *data;
+  std::ptrdiff_t ld;
+};
+
+// Uninitialised temporary from the calling thread's memory resource; the
+// schedule writes every element before reading it.
+class Scratch {
+ public:
+  explicit Scratch(std::size_t size)
+      : resource_(S21CurrentMemoryResource()),
+        bytes_(size * sizeof(double)),
+        data_(static_cast<double *>(
+            resource_->allocate(bytes_, alignof(std::max_align_t)))) {}
+  Scratch(const Scratch &) = delete;
+  Scratch &operator=(const Scratch &) = delete;
+  ~Scratch() {
+    resource_->deallocate(data_, bytes_, alignof(std::max_align_t));
+  }
+
+  double *data() const { return data_; }
+
+ private:
+  std::pmr::memory_resource *resource_;
+  std::size_t bytes_;
+  double *data_;
+};
+
+// c = a + sign * b over an m x n block.
+void Combine(int m, int n, ConstBlock a, double sign, ConstBlock b, Block c) {
+  for (int i = 0; i < m; i++) {
+    const double *a_row = a.data + i * a.ld;
+    const double *b_row = b.data + i * b.ld;
+    double *c_row = c.data + i * c.ld;
+    for (int j = 0; j < n; j++) {
+      c_row[j] = a_row[j] + sign * b_row[j];
+    }
+  }
+}
+
+void Classical(int m, int n, int k, ConstBlock a, ConstBlock b, Block c) {
+  s21::Gemm(m, n, k, 1.0, a.data, a.ld, 1, b.data, b.ld, 1, 0.0, c.data,
+            c.ld);
+}
+
+void Multiply(int m, int n, int k, ConstBlock a, ConstBlock b, Block c,
+              int crossover);
+
+// Even part: m, n and k are 2 * mh, 2 * nh and 2 * kh. The schedule keeps
+// three quadrant-sized temporaries (x for A, y for B, z for C) and builds
+// the remaining products directly in the quadrants of C.
+void Winograd(int mh, int nh, int kh, ConstBlock a, ConstBlock b, Block c,
+              int crossover) {
+  const ConstBlock a11{a.data, a.ld}, a12{a.data + kh, a.ld};
+  const ConstBlock a21{a.data + mh * a.ld, a.ld};
+  const ConstBlock a22{a.data + mh * a.ld + kh, a.ld};
+  const ConstBlock b11{b.data, b.ld}, b12{b.data + nh, b.ld};
+  const ConstBlock b21{b.data + kh * b.ld, b.ld};
+  const ConstBlock b22{b.data + kh * b.ld + nh, b.ld};
+  const Block c11{c.data, c.ld}, c12{c.data + nh, c.ld};
+  const Block c21{c.data + mh * c.ld, c.ld};
+  const Block c22{c.data + mh * c.ld + nh, c.ld};
+  auto in = [](Block block) { return ConstBlock{block.data, block.ld}; };
+
+  const Scratch x_buffer(static_cast<std::size_t>(mh) * kh);
+  const Scratch y_buffer(static_cast<std::size_t>(kh) * nh);
+  const Scratch z_buffer(static_cast<std::size_t>(mh) * nh);
+  const Block x{x_buffer.data(), kh}, y{y_buffer.data(), nh};
+  const Block z{z_buffer.data(), nh};
+
+  Combine(mh, kh, a11, -1.0, a21, x);  // S3
+  Combine(kh, nh, b22, -1.0, b12, y);  // T3
+  Multiply(mh, nh, kh, in(x), in(y), c21, crossover);  // P7
+  Combine(mh, kh, a21, 1.0, a22, x);   // S1
+  Combine(kh, nh, b12, -1.0, b11, y);  // T1
+  Multiply(mh, nh, kh, in(x), in(y), c22, crossover);  // P5
+  Combine(mh, kh, in(x), -1.0, a11, x);  // S2
+  Combine(kh, nh, b22, -1.0, in(y), y);  // T2
+  Multiply(mh, nh, kh, in(x), in(y), c12, crossover);  // P6
+  Combine(mh, kh, a12, -1.0, in(x), x);  // S4
+  Multiply(mh, nh, kh, in(x), b22, c11, crossover);  // P3
+  Multiply(mh, nh, kh, a11, b11, z, crossover);      // P1
+  Combine(mh, nh, in(z), 1.0, in(c12), c12);    // U2 = P1 + P6
+  Combine(mh, nh, in(c12), 1.0, in(c21), c21);  // U3 = U2 + P7
+  Combine(mh, nh, in(c12), 1.0, in(c22), c12);  // U4 = U2 + P5
+  Combine(mh, nh, in(c21), 1.0, in(c22), c22);  // U7 = U3 + P5
+  Combine(mh, nh, in(c12), 1.0, in(c11), c12);  // U5 = U4 + P3
+  Combine(kh, nh, in(y), -1.0, b21, y);         // T4
+  Multiply(mh, nh, kh, a22, in(y), c11, crossover);  // P4
+  Combine(mh, nh, in(c21), -1.0, in(c11), c21);  // U6 = U3 - P4
+  Multiply(mh, nh, kh, a12, b21, c11, crossover);  // P2
+  Combine(mh, nh, in(c11), 1.0, in(z), c11);     // U1 = P1 + P2
+}
+
+// Odd dimensions are peeled: the even leading part goes through Winograd,
+// the last column of A / row of B is added as a rank-1 update, and the last
+// row and column of C are computed classically.
+void Multiply(int m, int n, int k, ConstBlock a, ConstBlock b, Block c,
+              int crossover) {
+  if (m <= crossover || n <= crossover || k <= crossover || m < 2 || n < 2 ||
+      k < 2) {
+    Classical(m, n, k, a, b, c);
+    return;
+  }
+  const int me = m & ~1, ne = n & ~1, ke = k & ~1;
+  Winograd(me / 2, ne / 2, ke / 2, a, b, c, crossover);
+  if (ke != k) {
+    s21::Gemm(me, ne, 1, 1.0, a.data + ke, a.ld, 1, b.data + ke * b.ld, b.ld,
+              1, 1.0, c.data, c.ld);
+  }
+  if (ne != n) {
+    Classical(me, 1, k, a, ConstBlock{b.data + ne, b.ld},
+              Block{c.data + ne, c.ld});
+  }
+  if (me != m) {
+    Classical(1, n, k, ConstBlock{a.data + me * a.ld, a.ld}, b,
+              Block{c.data + me * c.ld, c.ld});
+  }
+}
+
+}  // namespace
+
+namespace s21 {
+
+void StrassenGemm(int m, int n, int k, const double *a, std::ptrdiff_t lda,
+                  const double *b, std::ptrdiff_t ldb, double *c,
+                  std::ptrdiff_t ldc, int crossover) {
+  Multiply(m, n, k, ConstBlock{a, lda}, ConstBlock{b, ldb}, Block{c, ldc},
+           crossover);
+}
+
+int StrassenCrossover() { return crossover_size.load(); }
+
+}  // namespace s21
+
+int S21Matrix::GetStrassenCrossover() { return s21::StrassenCrossover(); }
+
+void S21Matrix::SetStrassenCrossover(const int crossover) {
+  if (crossover < 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Crossover size must not be negative");
+  }
+  crossover_size.store(crossover);
+}
+
+double S21Matrix::StrassenErrorBound(const int size) {
+  const int crossover = s21::StrassenCrossover();
+  int levels = 0;
+  double base = size;
+  while (crossover > 0 && base > crossover && base >= 2) {
+    base = ceil(base / 2);
+    levels++;
+  }
+  const double unit_roundoff = ldexp(1.0, -53);
+  return (pow(18.0, levels) * (base * base + 6 * base) -
+          6 * base * ldexp(1.0, levels)) *
+         unit_roundoff;
+}
@@ -0,0 +1,21 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_STRASSEN_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_STRASSEN_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// C(m x n) = A(m x k) * B(k x n), all row-major, with the Strassen-Winograd
+// recursion (7 half-size products and 15 additions per level). A level is
+// applied while m, n and k all exceed crossover; below that, and for the
+// odd row/column peeled off at every level, Gemm is used.
+void StrassenGemm(int m, int n, int k, const double *a, std::ptrdiff_t lda,
+                  const double *b, std::ptrdiff_t ldb, double *c,
+                  std::ptrdiff_t ldc, int crossover);
+
+// Current crossover, 0 while the Strassen path is disabled.
+int StrassenCrossover();
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_STRASSEN_H_
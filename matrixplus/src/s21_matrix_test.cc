@@ -1,5 +1,14 @@
+#include <cstdint>
+
 #include "gtest/gtest.h"
+#include "s21_cholesky_factorization.h"
+#include "s21_fixed_matrix.h"
+#include "s21_lu_factorization.h"
+#include "s21_matrix_batch.h"
 #include "s21_matrix_oop.h"
+#include "s21_qr_factorization.h"
+#include "s21_sparse_matrix.h"
+#include "s21_symmetric_matrix.h"
 
 void FillMatrix(S21Matrix& matrix) {
   for (size_t i = 0; i < (size_t)matrix.GetRows(); ++i) {
@@ -365,6 +374,114 @@ TEST(MulMatrix, EmptyMatrix) {
   ASSERT_THROW(matrix1.MulMatrix(matrix2), std::invalid_argument);
 }
 
+S21Matrix NaiveProduct(S21Matrix a, S21Matrix b) {
+  S21Matrix res(a.GetRows(), b.GetCols());
+  for (int i = 0; i < a.GetRows(); i++) {
+    for (int j = 0; j < b.GetCols(); j++) {
+      for (int m = 0; m < a.GetCols(); m++) {
+        res(i, j) += a(i, m) * b(m, j);
+      }
+    }
+  }
+  return res;
+}
+
+TEST(MulMatrix, LargeOddSizes) {
+  S21Matrix matrix1(67, 91);
+  S21Matrix matrix2(91, 53);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  S21Matrix expected = NaiveProduct(matrix1, matrix2);
+
+  matrix1.MulMatrix(matrix2);
+
+  ASSERT_TRUE(matrix1 == expected);
+}
+
+TEST(MulMatrix, CustomBlocking) {
+  S21GemmBlocking saved = S21Matrix::GetGemmBlocking();
+  S21Matrix::SetGemmBlocking({6, 5, 10});
+  S21Matrix matrix1(45, 37);
+  S21Matrix matrix2(37, 29);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  S21Matrix expected = NaiveProduct(matrix1, matrix2);
+
+  S21Matrix result = matrix1 * matrix2;
+  S21Matrix::SetGemmBlocking(saved);
+
+  ASSERT_TRUE(result == expected);
+  ASSERT_THROW(S21Matrix::SetGemmBlocking({0, 1, 1}), std::invalid_argument);
+}
+
+TEST(MulMatrix, MultiplyIntoDestination) {
+  S21Matrix matrix1(6, 5), matrix2(5, 7), result(6, 7);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  FillMatrix(result);
+  const double* buffer = &result(0, 0);
+
+  S21Matrix::Multiply(matrix1, matrix2, result);
+
+  EXPECT_EQ(&result(0, 0), buffer);
+  EXPECT_TRUE(result == NaiveProduct(matrix1, matrix2));
+}
+
+TEST(MulMatrix, StrassenOddAndRectangular) {
+  ASSERT_EQ(S21Matrix::GetStrassenCrossover(), 0);
+  S21Matrix::SetStrassenCrossover(8);
+  const int shapes[][3] = {{64, 64, 64}, {67, 91, 53}, {40, 17, 33}};
+  for (const auto& shape : shapes) {
+    S21Matrix matrix1(shape[0], shape[1]), matrix2(shape[1], shape[2]);
+    for (int i = 0; i < shape[0]; i++) {
+      for (int j = 0; j < shape[1]; j++) {
+        matrix1(i, j) = sin(i * 0.7 + j);
+      }
+    }
+    for (int i = 0; i < shape[1]; i++) {
+      for (int j = 0; j < shape[2]; j++) {
+        matrix2(i, j) = cos(i - j * 0.3);
+      }
+    }
+    S21Matrix expected = NaiveProduct(matrix1, matrix2);
+    S21Matrix result(3, 3);
+    S21Matrix::Multiply(matrix1, matrix2, result);
+    const double bound = S21Matrix::StrassenErrorBound(
+        std::max({shape[0], shape[1], shape[2]}));
+    for (int i = 0; i < shape[0]; i++) {
+      for (int j = 0; j < shape[2]; j++) {
+        ASSERT_NEAR(result(i, j), expected(i, j), bound);
+      }
+    }
+    EXPECT_TRUE(matrix1 * matrix2 == expected);
+  }
+  S21Matrix::SetStrassenCrossover(0);
+  EXPECT_THROW(S21Matrix::SetStrassenCrossover(-1), std::invalid_argument);
+}
+
+TEST(MulMatrix, StrassenErrorBound) {
+  EXPECT_DOUBLE_EQ(S21Matrix::StrassenErrorBound(100), 1e4 * ldexp(1.0, -53));
+  S21Matrix::SetStrassenCrossover(64);
+  const double one_level = S21Matrix::StrassenErrorBound(128);
+  EXPECT_DOUBLE_EQ(one_level, (18.0 * (64 * 64 + 6 * 64) - 12 * 64) *
+                                  ldexp(1.0, -53));
+  EXPECT_GT(S21Matrix::StrassenErrorBound(256), 4 * one_level);
+  S21Matrix::SetStrassenCrossover(0);
+}
+
+TEST(MulMatrix, MultiplyAliasedDestination) {
+  S21Matrix matrix1(4, 4), matrix2(4, 4);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  S21Matrix expected = NaiveProduct(matrix1, matrix2);
+
+  S21Matrix::Multiply(matrix1, matrix2, matrix1);
+
+  EXPECT_TRUE(matrix1 == expected);
+  EXPECT_THROW(S21Matrix::Multiply(matrix1, S21Matrix(3, 4), matrix2),
+               std::invalid_argument);
+}
+
 /*=======| Transpose |=======*/
 
 TEST(Transpose, SquareMatrix) {
@@ -420,6 +537,49 @@ TEST(Transpose, SingleElementMatrix) {
   ASSERT_EQ(transposed(0, 0), 42);
 }
 
+TEST(Transpose, LargeMatrices) {
+  const int shapes[][2] = {{33, 97}, {130, 70}, {520, 515}};
+  for (const auto &shape : shapes) {
+    S21Matrix matrix(shape[0], shape[1]);
+    FillMatrix(matrix);
+    S21Matrix transposed = matrix.Transpose();
+    ASSERT_EQ(transposed.GetRows(), shape[1]);
+    ASSERT_EQ(transposed.GetCols(), shape[0]);
+    for (int i = 0; i < shape[0]; i++) {
+      for (int j = 0; j < shape[1]; j++) {
+        ASSERT_EQ(transposed(j, i), matrix(i, j));
+      }
+    }
+    EXPECT_TRUE(transposed.Transpose() == matrix);
+  }
+}
+
+TEST(Transpose, InPlaceSquare) {
+  const int sizes[] = {1, 3, 32, 37, 100, 512};
+  for (int n : sizes) {
+    S21Matrix matrix(n, n);
+    FillMatrix(matrix);
+    const S21Matrix original = matrix;
+    const double *data = &matrix(0, 0);
+    matrix.TransposeInPlace();
+    EXPECT_EQ(&matrix(0, 0), data);
+    EXPECT_TRUE(matrix == original.Transpose());
+  }
+}
+
+TEST(Transpose, InPlaceRectangular) {
+  S21Matrix matrix(3, 70);
+  FillMatrix(matrix);
+  const S21Matrix original = matrix;
+  matrix.TransposeInPlace();
+  EXPECT_EQ(matrix.GetRows(), 70);
+  EXPECT_EQ(matrix.GetCols(), 3);
+  EXPECT_TRUE(matrix == original.Transpose());
+  S21Matrix empty;
+  empty.TransposeInPlace();
+  EXPECT_EQ(empty.GetRows(), 0);
+}
+
 /*=======| CalcComplements |=======*/
 
 TEST(CalcComplements, ValidCalcComplements) {
@@ -452,6 +612,62 @@ TEST(CalcComplements, DifferentDimensions) {
   EXPECT_THROW(matrix1.CalcComplements(), std::invalid_argument);
 }
 
+TEST(CalcComplements, RegularMatrix) {
+  S21Matrix matrix(60, 60);
+  FillMatrix(matrix);
+  for (int i = 0; i < 60; i++) {
+    matrix(i, i) += 50;
+  }
+  double determinant = matrix.Determinant();
+
+  S21Matrix result = matrix.CalcComplements();
+  S21Matrix product = matrix * result.Transpose();
+
+  for (int i = 0; i < 60; i++) {
+    for (int j = 0; j < 60; j++) {
+      EXPECT_NEAR(product(i, j) / determinant, i == j ? 1.0 : 0.0, 1e-9);
+    }
+  }
+}
+
+TEST(CalcComplements, SingularMatrix) {
+  const double values[5][5] = {{2, -1, 0, 3, 1},
+                               {1, 4, 2, 0, -2},
+                               {0, 3, 5, 1, 1},
+                               {4, 0, -1, 2, 3},
+                               {3, 3, 2, 3, -1}};
+  const double expected[5] = {-144, 133, -118, 115, 76};
+  const double row_sign[5] = {1, 1, 0, 0, -1};
+  S21Matrix matrix(5, 5);
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      matrix(i, j) = values[i][j];
+    }
+  }
+
+  S21Matrix result = matrix.CalcComplements();
+
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      EXPECT_NEAR(result(i, j), row_sign[i] * expected[j], 1e-9);
+    }
+  }
+}
+
+TEST(CalcComplements, RankDeficientMatrix) {
+  S21Matrix matrix(4, 4);
+  for (int j = 0; j < 4; j++) {
+    matrix(0, j) = j + 1;
+    matrix(1, j) = 2 * (j + 1);
+    matrix(2, j) = j % 2;
+    matrix(3, j) = 3 * (j + 1);
+  }
+
+  S21Matrix result = matrix.CalcComplements();
+
+  EXPECT_TRUE(result == S21Matrix(4, 4));
+}
+
 /*=======| Determinant |=======*/
 
 TEST(Determinant, ValidDeterminant) {
@@ -484,6 +700,59 @@ TEST(Determinant, ZeroDeterminant) {
   EXPECT_EQ(matrix1.Determinant(), 0.0);
 }
 
+TEST(Determinant, FiveByFive) {
+  const double values[5][5] = {{2, -1, 0, 3, 1},
+                               {1, 4, 2, 0, -2},
+                               {0, 3, 5, 1, 1},
+                               {4, 0, -1, 2, 3},
+                               {1, 1, 1, 1, 0}};
+  S21Matrix matrix(5, 5);
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      matrix(i, j) = values[i][j];
+    }
+  }
+
+  EXPECT_NEAR(matrix.Determinant(), 14.0, 1e-9);
+}
+
+TEST(Determinant, LargeMatrix) {
+  const int size = 40;
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix(i, j) = (i == j) ? 2.0 : 1.0;
+    }
+  }
+
+  EXPECT_NEAR(matrix.Determinant(), size + 1.0, 1e-6);
+}
+
+TEST(Determinant, LargeSingularMatrix) {
+  S21Matrix matrix(30, 30);
+  FillMatrix(matrix);
+  for (int j = 0; j < 30; j++) {
+    matrix(29, j) = 0.0;
+  }
+
+  EXPECT_EQ(matrix.Determinant(), 0.0);
+}
+
+TEST(Determinant, FourByFour) {
+  S21Matrix matrix(4, 4);
+  const double values[4][4] = {
+      {3, 2, 0, 1}, {4, 0, 1, 2}, {3, 0, 2, 1}, {9, 2, 3, 1}};
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      matrix(i, j) = values[i][j];
+    }
+  }
+  EXPECT_EQ(matrix.Determinant(), 24.0);
+  matrix.SetRows(3);
+  matrix.SetRows(4);
+  EXPECT_EQ(matrix.Determinant(), 0.0);
+}
+
 /*=======| InverseMatrix |=======*/
 
 TEST(InverseMatrix, ValidInverseMatrix) {
@@ -510,6 +779,93 @@ TEST(InverseMatrix, DiffInverseMatrix) {
   EXPECT_THROW(matrix1.InverseMatrix(), std::invalid_argument);
 }
 
+TEST(InverseMatrix, LargeMatrix) {
+  S21Matrix matrix(150, 150);
+  FillMatrix(matrix);
+  for (int i = 0; i < 150; i++) {
+    matrix(i, i) += 100;
+  }
+  S21Matrix identity(150, 150);
+  for (int i = 0; i < 150; i++) {
+    identity(i, i) = 1;
+  }
+
+  S21Matrix result = matrix.InverseMatrix();
+
+  EXPECT_TRUE(matrix * result == identity);
+  EXPECT_TRUE(result * matrix == identity);
+}
+
+TEST(InverseMatrix, LargeSingularMatrix) {
+  S21Matrix matrix(100, 100);
+  FillMatrix(matrix);
+  for (int j = 0; j < 100; j++) {
+    matrix(99, j) = matrix(0, j) + matrix(1, j);
+  }
+  EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(InverseMatrix, NotSquare) {
+  S21Matrix matrix(4, 5);
+  EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(InverseMatrix, SmallSizesMatchProduct) {
+  for (int n = 1; n <= 5; n++) {
+    S21Matrix matrix(n, n);
+    FillMatrix(matrix);
+    for (int i = 0; i < n; i++) {
+      matrix(i, i) += 40;
+    }
+    S21Matrix identity(n, n);
+    for (int i = 0; i < n; i++) {
+      identity(i, i) = 1;
+    }
+    EXPECT_TRUE(matrix * matrix.InverseMatrix() == identity);
+    S21Matrix complements = matrix.CalcComplements();
+    S21Matrix adjugate = matrix.InverseMatrix() * matrix.Determinant();
+    EXPECT_TRUE(complements.Transpose() == adjugate);
+  }
+}
+
+TEST(InverseMatrix, FourByFourSingularAndScaled) {
+  S21Matrix matrix(4, 4);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      matrix(i, j) = i + j;
+    }
+  }
+  EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(4, 4).InverseMatrix(), std::invalid_argument);
+  S21Matrix small(4, 4);
+  for (int i = 0; i < 4; i++) {
+    small(i, i) = 0.01;
+  }
+  EXPECT_DOUBLE_EQ(small.InverseMatrix()(3, 3), 100.0);
+}
+
+TEST(InverseMatrix, SingularityIsScaleRelative) {
+  // The closed forms (n <= 4) and the LU path (n >= 5) agree on the verdict.
+  for (int n = 3; n <= 5; n++) {
+    S21Matrix negligible(n, n), tiny(n, n), scaled(n, n);
+    for (int i = 0; i < n; i++) {
+      negligible(i, i) = i == n - 1 ? 1e-8 : 1.0;
+      tiny(i, i) = i == n - 1 ? 1e-6 : 1.0;
+      for (int j = 0; j < n; j++) {
+        scaled(i, j) = 1e-3 * (i == j ? n + 1.0 : 1.0 / (1 + i + j));
+      }
+    }
+    EXPECT_THROW(negligible.InverseMatrix(), std::invalid_argument) << n;
+    EXPECT_NEAR(tiny.InverseMatrix()(n - 1, n - 1), 1e6, 1e-3) << n;
+    S21Matrix product = scaled * scaled.InverseMatrix();
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        EXPECT_NEAR(product(i, j), i == j ? 1.0 : 0.0, 1e-9) << n;
+      }
+    }
+  }
+}
+
 /*==========================| Операторы |============================*/
 
 /*=======| Operator + |=======*/
@@ -688,6 +1044,17 @@ TEST(OperatorAssignment, EmptyMatrix) {
   ASSERT_TRUE(matrix1 == matrix2);
 }
 
+TEST(OperatorAssignment, SameShapeKeepsBuffer) {
+  S21Matrix matrix1(3, 3), matrix2(3, 3);
+  FillMatrix(matrix1);
+  const double* buffer = &matrix2(0, 0);
+
+  matrix2 = matrix1;
+
+  EXPECT_EQ(&matrix2(0, 0), buffer);
+  EXPECT_TRUE(matrix1 == matrix2);
+}
+
 /*=======| Operator == |=======*/
 
 TEST(OperatorEquality, EqualMatrices) {
@@ -888,6 +1255,746 @@ TEST(OperatorMulEqualMatr, MulMatDiffSizes) {
   ASSERT_EQ(matrix1(1, 1), 76);
 }
 
+/*=======| Выражения |=======*/
+
+TEST(Expression, ChainedFormula) {
+  S21Matrix a(3, 4), b(3, 4), c(3, 4);
+  FillMatrix(a);
+  FillMatrix(b);
+  FillMatrix(c);
+
+  S21Matrix result = a + b - c * 2.0 + 0.5 * (a - b);
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_DOUBLE_EQ(result(i, j), a(i, j) + b(i, j) - c(i, j) * 2.0 +
+                                         0.5 * (a(i, j) - b(i, j)));
+    }
+  }
+}
+
+TEST(Expression, DifferentDimensions) {
+  S21Matrix a(3, 4), b(3, 4), c(4, 3);
+  EXPECT_THROW(a + b - c, std::invalid_argument);
+  EXPECT_THROW(S21Matrix() + S21Matrix(), std::invalid_argument);
+  EXPECT_THROW(c += a * 2.0, std::invalid_argument);
+}
+
+TEST(Expression, AssignAndAccumulate) {
+  S21Matrix a(5, 6), b(5, 6);
+  FillMatrix(a);
+  FillMatrix(b);
+  S21Matrix expected = a * 3.0 - b;
+
+  S21Matrix result(2, 2);
+  result = a + a;
+  result += a - b;
+
+  EXPECT_TRUE(result == expected);
+  EXPECT_TRUE(a * 3.0 - b == result);
+
+  result = result - b + b;
+  EXPECT_TRUE(result == expected);
+}
+
+TEST(Expression, ProductOfExpressions) {
+  S21Matrix a(2, 2), b(2, 2);
+  a(0, 0) = 1;
+  a(1, 1) = 1;
+  b(0, 1) = 2;
+  b(1, 0) = 3;
+
+  S21Matrix result = (a + b) * (a - b);
+
+  EXPECT_EQ(result(0, 0), -5);
+  EXPECT_EQ(result(0, 1), 0);
+  EXPECT_EQ(result(1, 0), 0);
+  EXPECT_EQ(result(1, 1), -5);
+}
+
+TEST(Expression, ExpiringOperandKeepsBuffer) {
+  S21Matrix a(4, 4), b(4, 4), c(4, 4);
+  FillMatrix(a);
+  FillMatrix(b);
+  FillMatrix(c);
+  S21Matrix expected = (a + b - c) * 2.0;
+  const double* buffer = &a(0, 0);
+
+  S21Matrix result = 2.0 * ((std::move(a) + b) - c);
+
+  EXPECT_EQ(&result(0, 0), buffer);
+  EXPECT_TRUE(result == expected);
+}
+
+TEST(Expression, ExpiringRightOperand) {
+  S21Matrix a(3, 3), b(3, 3);
+  FillMatrix(a);
+  FillMatrix(b);
+  S21Matrix expected = a - b * 3.0;
+  S21Matrix scaled = b * 3.0;
+  const double* buffer = &scaled(0, 0);
+
+  S21Matrix result = a - std::move(scaled);
+
+  EXPECT_EQ(&result(0, 0), buffer);
+  EXPECT_TRUE(result == expected);
+}
+
+TEST(Expression, ConstOperands) {
+  S21Matrix a(2, 3);
+  FillMatrix(a);
+  const S21Matrix& const_a = a;
+
+  S21Matrix result = 3.0 * const_a - const_a + const_a.Transpose().Transpose();
+
+  EXPECT_TRUE(result == a * 3.0);
+}
+
+/*=======| Представления |=======*/
+
+TEST(MatrixView, TransposedViewIsZeroCopy) {
+  S21Matrix matrix(3, 5);
+  FillMatrix(matrix);
+  S21MatrixView view = matrix.TransposedView();
+  EXPECT_EQ(view.Data(), &matrix(0, 0));
+  EXPECT_EQ(view.GetRows(), 5);
+  EXPECT_EQ(view.GetCols(), 3);
+  EXPECT_TRUE(view.IsTransposed());
+  EXPECT_FALSE(view.Transpose().IsTransposed());
+  EXPECT_EQ(view(4, 2), matrix(2, 4));
+  EXPECT_THROW(view(3, 4), std::out_of_range);
+  EXPECT_TRUE(matrix.Transpose() == view);
+}
+
+TEST(MatrixView, ProductsWithTransposedOperands) {
+  const int sizes[] = {5, 37, 130};
+  for (int n : sizes) {
+    S21Matrix a(n + 3, n), b(n + 3, n - 2);
+    FillMatrix(a);
+    FillMatrix(b);
+    S21Matrix expected = NaiveProduct(a.Transpose(), b);
+    EXPECT_TRUE(a.TransposedView() * b == expected);
+    S21Matrix c(n - 2, n);
+    FillMatrix(c);
+    EXPECT_TRUE(a * c.TransposedView() == NaiveProduct(a, c.Transpose()));
+    S21Matrix result = c;
+    result.MulMatrix(a.TransposedView());
+    EXPECT_TRUE(result == NaiveProduct(c, a.Transpose()));
+  }
+}
+
+TEST(MatrixView, ElementwiseAndExpressions) {
+  S21Matrix a(4, 6), b(6, 4);
+  FillMatrix(a);
+  FillMatrix(b);
+  S21Matrix sum = b;
+  sum.SumMatrix(a.TransposedView());
+  S21Matrix diff = b;
+  diff.SubMatrix(a.TransposedView());
+  S21Matrix formula = a.TransposedView() * 2.0 + b;
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_EQ(sum(i, j), b(i, j) + a(j, i));
+      EXPECT_EQ(diff(i, j), b(i, j) - a(j, i));
+      EXPECT_EQ(formula(i, j), 2.0 * a(j, i) + b(i, j));
+    }
+  }
+  EXPECT_THROW(a.SumMatrix(a.TransposedView()), std::invalid_argument);
+}
+
+TEST(MatrixView, AliasedDestination) {
+  S21Matrix matrix(20, 20);
+  FillMatrix(matrix);
+  const S21Matrix original = matrix;
+  matrix += matrix.TransposedView();
+  EXPECT_TRUE(matrix == original + original.Transpose());
+  matrix = original;
+  matrix = matrix.TransposedView();
+  EXPECT_TRUE(matrix == original.Transpose());
+  matrix = original;
+  matrix.MulMatrix(matrix.TransposedView());
+  EXPECT_TRUE(matrix == NaiveProduct(original, original.Transpose()));
+  matrix = original;
+  S21Matrix::Multiply(matrix.TransposedView(), matrix, matrix);
+  EXPECT_TRUE(matrix == NaiveProduct(original.Transpose(), original));
+}
+
+TEST(MatrixBlock, SharesStorage) {
+  S21Matrix matrix(6, 7);
+  FillMatrix(matrix);
+  S21MatrixBlock block = matrix.Block(2, 3, 3, 4);
+  EXPECT_EQ(block.Data(), &matrix(2, 3));
+  EXPECT_EQ(block.GetRows(), 3);
+  EXPECT_EQ(block.GetCols(), 4);
+  block(1, 2) = -1.0;
+  EXPECT_EQ(matrix(3, 5), -1.0);
+  EXPECT_EQ(block.Block(1, 1, 2, 2)(0, 1), -1.0);
+  const S21Matrix &constant = matrix;
+  EXPECT_EQ(constant.Block(3, 5, 1, 1)(0, 0), -1.0);
+  EXPECT_THROW(matrix.Block(4, 0, 3, 1), std::out_of_range);
+  EXPECT_THROW(matrix.Block(0, -1, 1, 1), std::out_of_range);
+  EXPECT_THROW(matrix.Block(0, 0, -1, 1), std::out_of_range);
+  EXPECT_THROW(block(3, 0), std::out_of_range);
+}
+
+TEST(MatrixBlock, InPlaceOperations) {
+  S21Matrix matrix(5, 5), other(2, 3);
+  FillMatrix(matrix);
+  FillMatrix(other);
+  const S21Matrix original = matrix;
+  S21MatrixBlock block = matrix.Block(1, 2, 2, 3);
+  block += other;
+  block *= 2.0;
+  block -= other * 0.5;
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      const bool inside = i >= 1 && i < 3 && j >= 2;
+      const double expected =
+          inside ? 2.0 * (original(i, j) + other(i - 1, j - 2)) -
+                       0.5 * other(i - 1, j - 2)
+                 : original(i, j);
+      EXPECT_DOUBLE_EQ(matrix(i, j), expected);
+    }
+  }
+  EXPECT_THROW(block += matrix, std::invalid_argument);
+  S21Matrix rotation(3, 3);
+  FillMatrix(rotation);
+  S21Matrix expected = NaiveProduct(S21Matrix(block), rotation);
+  block *= rotation;
+  EXPECT_TRUE(S21Matrix(matrix.Block(1, 2, 2, 3)) == expected);
+  EXPECT_THROW(block *= other, std::invalid_argument);
+}
+
+TEST(MatrixBlock, OverlappingSources) {
+  S21Matrix matrix(8, 8);
+  FillMatrix(matrix);
+  const S21Matrix original = matrix;
+  matrix.Block(1, 1, 4, 4) = matrix.Block(0, 0, 4, 4);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_EQ(matrix(i + 1, j + 1), original(i, j));
+    }
+  }
+  const S21Matrix shifted = matrix;
+  matrix.Block(0, 4, 4, 4) += matrix.Block(0, 3, 4, 4);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_EQ(matrix(i, j + 4), shifted(i, j + 4) + shifted(i, j + 3));
+    }
+  }
+  matrix = original;
+  matrix.Block(0, 0, 8, 4) = matrix.Block(0, 4, 8, 4);
+  matrix.Block(4, 0, 4, 8) = original.TransposedView().Block(0, 0, 4, 8);
+  EXPECT_EQ(matrix(0, 0), original(0, 4));
+  EXPECT_EQ(matrix(4, 7), original(7, 0));
+}
+
+TEST(MatrixBlock, BlockedProduct) {
+  const int n = 64, tile = 16;
+  S21Matrix a(n, n), b(n, n), c(n, n);
+  FillMatrix(a);
+  FillMatrix(b);
+  for (int i = 0; i < n; i += tile) {
+    for (int j = 0; j < n; j += tile) {
+      for (int k = 0; k < n; k += tile) {
+        c.Block(i, j, tile, tile) +=
+            a.Block(i, k, tile, tile) * b.Block(k, j, tile, tile);
+      }
+    }
+  }
+  EXPECT_TRUE(c == NaiveProduct(a, b));
+}
+
+/*=======| Gemm |=======*/
+
+TEST(Gemm, TransposeFlagsAndScaling) {
+  const S21Transpose flags[] = {S21Transpose::kNone,
+                                S21Transpose::kTranspose};
+  const int shapes[][3] = {{5, 4, 6}, {70, 90, 50}};
+  S21GemmBlocking saved = S21Matrix::GetGemmBlocking();
+  S21Matrix::SetGemmBlocking({8, 16, 16});
+  for (const auto& shape : shapes) {
+    const int m = shape[0], k = shape[1], n = shape[2];
+    for (S21Transpose trans_a : flags) {
+      for (S21Transpose trans_b : flags) {
+        const bool ta = trans_a == S21Transpose::kTranspose;
+        const bool tb = trans_b == S21Transpose::kTranspose;
+        S21Matrix a(ta ? k : m, ta ? m : k), b(tb ? n : k, tb ? k : n);
+        S21Matrix c(m, n);
+        FillMatrix(a);
+        FillMatrix(b);
+        FillMatrix(c);
+        S21Matrix expected =
+            NaiveProduct(ta ? a.Transpose() : a, tb ? b.Transpose() : b) *
+                0.5 +
+            c * -2.0;
+        S21Matrix::Gemm(trans_a, trans_b, 0.5, a, b, -2.0, c);
+        EXPECT_TRUE(c == expected);
+      }
+    }
+  }
+  S21Matrix::SetGemmBlocking(saved);
+}
+
+TEST(Gemm, BetaZeroIgnoresDestination) {
+  S21Matrix a(3, 4), b(4, 2), c(3, 2), resized(7, 7);
+  FillMatrix(a);
+  FillMatrix(b);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 2; j++) c(i, j) = NAN;
+  }
+  S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 1.0, a, b, 0.0, c);
+  EXPECT_TRUE(c == NaiveProduct(a, b));
+  S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 2.0, a, b, 0.0,
+                  resized);
+  EXPECT_TRUE(resized == NaiveProduct(a, b) * 2.0);
+  S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 0.0, a, b, 3.0,
+                  resized);
+  EXPECT_TRUE(resized == NaiveProduct(a, b) * 6.0);
+}
+
+TEST(Gemm, InvalidShapes) {
+  S21Matrix a(3, 4), b(4, 2), c(2, 2);
+  EXPECT_THROW(S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 1.0,
+                               a, b, 1.0, c),
+               std::invalid_argument);
+  EXPECT_THROW(S21Matrix::Gemm(S21Transpose::kTranspose, S21Transpose::kNone,
+                               1.0, a, b, 0.0, c),
+               std::invalid_argument);
+  EXPECT_EQ(c.GetRows(), 2);
+  S21Matrix empty;
+  EXPECT_THROW(S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 1.0,
+                               empty, empty, 0.0, c),
+               std::invalid_argument);
+}
+
+TEST(Gemm, AliasedAndBlockDestinations) {
+  S21Matrix c(40, 40);
+  FillMatrix(c);
+  const S21Matrix original = c;
+  S21Matrix::Gemm(S21Transpose::kTranspose, S21Transpose::kNone, 1.0, c, c,
+                  1.0, c);
+  EXPECT_TRUE(c == NaiveProduct(original.Transpose(), original) + original);
+
+  S21Matrix a(3, 2), b(2, 3), target(6, 6);
+  FillMatrix(a);
+  FillMatrix(b);
+  FillMatrix(target);
+  const S21Matrix before = target;
+  S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 1.0, a, b, 1.0,
+                  target.Block(2, 1, 3, 3));
+  S21Matrix::Gemm(S21Transpose::kNone, S21Transpose::kNone, 1.0,
+                  target.Block(0, 0, 2, 2), target.Block(0, 0, 2, 2), 0.0,
+                  target.Block(1, 1, 2, 2));
+  S21Matrix top = before.Block(0, 0, 2, 2);
+  EXPECT_TRUE(S21Matrix(target.Block(1, 1, 2, 2)) == NaiveProduct(top, top));
+  const S21Matrix sum = NaiveProduct(a, b);
+  EXPECT_EQ(target(4, 3), before(4, 3) + sum(2, 2));
+  EXPECT_EQ(target(0, 5), before(0, 5));
+}
+
+/*=======| Симметричные матрицы |=======*/
+
+TEST(Syrk, MatchesGeneralProduct) {
+  const int shapes[][2] = {{5, 3}, {150, 40}};
+  for (const auto& shape : shapes) {
+    S21Matrix a(shape[0], shape[1]), c(shape[0], shape[0]);
+    FillMatrix(a);
+    FillMatrix(c);
+    c = c + c.Transpose();
+    S21Matrix expected = NaiveProduct(a, a.Transpose()) * 0.5 + c * 2.0;
+    S21Matrix::Syrk(S21Transpose::kNone, 0.5, a, 2.0, c);
+    EXPECT_TRUE(c == expected);
+    EXPECT_TRUE(c == c.Transpose());
+
+    S21Matrix gram;
+    S21Matrix::Syrk(S21Transpose::kTranspose, 1.0, a, 0.0, gram);
+    EXPECT_TRUE(gram == NaiveProduct(a.Transpose(), a));
+  }
+}
+
+TEST(Syrk, AliasedAndInvalid) {
+  S21Matrix c(70, 70);
+  FillMatrix(c);
+  const S21Matrix original = c;
+  S21Matrix::Syrk(S21Transpose::kNone, 1.0, c, 0.0, c);
+  EXPECT_TRUE(c == NaiveProduct(original, original.Transpose()));
+  S21Matrix a(3, 4), wrong(4, 4), empty;
+  EXPECT_THROW(S21Matrix::Syrk(S21Transpose::kNone, 1.0, a, 1.0, wrong),
+               std::invalid_argument);
+  EXPECT_THROW(S21Matrix::Syrk(S21Transpose::kNone, 1.0, empty, 0.0, wrong),
+               std::invalid_argument);
+}
+
+TEST(SymmetricMatrix, PackedStorage) {
+  S21SymmetricMatrix matrix(4);
+  EXPECT_EQ(matrix.GetSize(), 4);
+  matrix(1, 3) = 5.0;
+  EXPECT_EQ(matrix(3, 1), 5.0);
+  matrix(2, 2) = -1.0;
+  S21Matrix full = matrix.ToMatrix();
+  EXPECT_EQ(full(1, 3), 5.0);
+  EXPECT_EQ(full(3, 1), 5.0);
+  EXPECT_EQ(full(2, 2), -1.0);
+  EXPECT_TRUE(S21SymmetricMatrix(full) == matrix);
+  EXPECT_THROW(matrix(4, 0), std::out_of_range);
+  EXPECT_THROW(S21SymmetricMatrix(0), std::out_of_range);
+  S21Matrix square(3, 3), rectangle(2, 3);
+  square(0, 1) = 1.0;
+  EXPECT_THROW(S21SymmetricMatrix{square}, std::invalid_argument);
+  EXPECT_THROW(S21SymmetricMatrix{rectangle}, std::invalid_argument);
+  // A covariance with entries around 1e6 carries rounding above 1e-7.
+  S21Matrix covariance(2, 2);
+  covariance(0, 0) = covariance(1, 1) = 2e6;
+  covariance(0, 1) = 1e6;
+  covariance(1, 0) = 1e6 + 1e-3;
+  EXPECT_DOUBLE_EQ(S21SymmetricMatrix(covariance)(1, 0), 1e6 + 1e-3);
+  EXPECT_NO_THROW(S21CholeskyFactorization c(covariance));
+  covariance(1, 0) += 1.0;
+  EXPECT_THROW(S21SymmetricMatrix{covariance}, std::invalid_argument);
+}
+
+TEST(SymmetricMatrix, PackedSyrkAndArithmetic) {
+  S21Matrix a(150, 30);
+  FillMatrix(a);
+  S21SymmetricMatrix gram;
+  gram.Syrk(S21Transpose::kNone, 1.0, a, 0.0);
+  S21Matrix expected;
+  S21Matrix::Syrk(S21Transpose::kNone, 1.0, a, 0.0, expected);
+  EXPECT_TRUE(gram.ToMatrix() == expected);
+
+  gram.Syrk(S21Transpose::kNone, 2.0, a, -1.0);
+  EXPECT_TRUE(gram.ToMatrix() == expected);
+  EXPECT_THROW(gram.Syrk(S21Transpose::kTranspose, 1.0, a, 1.0),
+               std::invalid_argument);
+
+  S21SymmetricMatrix twice = gram + gram;
+  EXPECT_TRUE(twice == gram * 2.0);
+  EXPECT_TRUE(twice - gram == gram);
+  EXPECT_FALSE(twice == gram);
+  S21SymmetricMatrix moved = std::move(twice);
+  EXPECT_EQ(moved.GetSize(), 150);
+  EXPECT_EQ(twice.GetSize(), 0);
+  EXPECT_THROW(moved += S21SymmetricMatrix(3), std::invalid_argument);
+
+  // The strip buffer comes from the scope's pool, which caches it.
+  S21PoolResource upstream;
+  S21PoolResource pool(std::size_t(1) << 22, &upstream);
+  S21MemoryResourceScope scope(&pool);
+  S21SymmetricMatrix scoped(150);
+  scoped.Syrk(S21Transpose::kNone, 1.0, a, 0.0);
+  EXPECT_EQ(pool.BlocksInUse(), 1u);
+  EXPECT_EQ(upstream.BlocksInUse(), 2u);
+  EXPECT_TRUE(scoped.ToMatrix() == expected);
+}
+
+/*=======| Разреженные матрицы |=======*/
+
+S21Matrix SparseDense(int rows, int cols) {
+  S21Matrix dense(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if (rand() % 10 == 0) dense(i, j) = rand() % 20 - 10;
+    }
+  }
+  return dense;
+}
+
+TEST(SparseMatrix, FromTriplets) {
+  const std::vector<S21Triplet> triplets = {
+      {2, 1, 4.0}, {0, 3, 1.0}, {2, 1, 1.5}, {1, 0, -2.0}, {0, 0, 3.0},
+      {1, 2, 1.0}, {1, 2, -1.0}};
+  for (S21SparseFormat format :
+       {S21SparseFormat::kCsr, S21SparseFormat::kCsc}) {
+    S21SparseMatrix sparse(3, 4, triplets, format);
+    EXPECT_EQ(sparse.GetFormat(), format);
+    EXPECT_EQ(sparse.NonZeros(), 4u);
+    EXPECT_EQ(sparse(2, 1), 5.5);
+    EXPECT_EQ(sparse(0, 3), 1.0);
+    EXPECT_EQ(sparse(1, 2), 0.0);
+    EXPECT_EQ(sparse(2, 3), 0.0);
+    S21Matrix dense = sparse.ToDense();
+    EXPECT_EQ(dense(1, 0), -2.0);
+    EXPECT_TRUE(S21SparseMatrix(dense, format) == sparse);
+  }
+  const S21SparseMatrix csr(3, 4, triplets);
+  EXPECT_EQ(csr.Pointers()[1], 2u);
+  EXPECT_EQ(csr.Indices()[1], 3);
+  EXPECT_EQ(csr.Values()[0], 3.0);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {{3, 0, 1.0}}), std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix(0, 4), std::out_of_range);
+  EXPECT_THROW(csr(0, 4), std::out_of_range);
+}
+
+TEST(SparseMatrix, FormatsAndTranspose) {
+  S21Matrix dense = SparseDense(37, 23);
+  S21SparseMatrix csr(dense);
+  S21SparseMatrix csc = csr.ToFormat(S21SparseFormat::kCsc);
+  EXPECT_EQ(csc.GetFormat(), S21SparseFormat::kCsc);
+  EXPECT_EQ(csc.NonZeros(), csr.NonZeros());
+  EXPECT_TRUE(csc.ToDense() == dense);
+  EXPECT_TRUE(csc.ToFormat(S21SparseFormat::kCsr) == csr);
+  S21SparseMatrix transposed = csr.Transpose();
+  EXPECT_EQ(transposed.GetRows(), 23);
+  EXPECT_EQ(transposed.GetFormat(), S21SparseFormat::kCsc);
+  EXPECT_TRUE(transposed.ToDense() == dense.Transpose());
+}
+
+TEST(SparseMatrix, Products) {
+  S21Matrix dense = SparseDense(60, 45), other(45, 20);
+  FillMatrix(other);
+  std::vector<double> x(45);
+  for (double& value : x) value = rand() % 7 - 3;
+  for (S21SparseFormat format :
+       {S21SparseFormat::kCsr, S21SparseFormat::kCsc}) {
+    S21SparseMatrix sparse(dense, format);
+    EXPECT_TRUE(sparse * other == NaiveProduct(dense, other));
+    S21Matrix wide(20, 45);
+    FillMatrix(wide);
+    EXPECT_TRUE(sparse.MulMatrix(wide.TransposedView()) ==
+                NaiveProduct(dense, wide.Transpose()));
+    std::vector<double> y = sparse * x;
+    ASSERT_EQ(y.size(), 60u);
+    for (int i = 0; i < 60; i++) {
+      double expected = 0.0;
+      for (int j = 0; j < 45; j++) expected += dense(i, j) * x[j];
+      EXPECT_DOUBLE_EQ(y[i], expected);
+    }
+    EXPECT_THROW(sparse.MulVector(std::vector<double>(44)),
+                 std::invalid_argument);
+    EXPECT_THROW(sparse * S21Matrix(44, 2), std::invalid_argument);
+  }
+}
+
+TEST(SparseMatrix, Arithmetic) {
+  S21Matrix a = SparseDense(30, 40), b = SparseDense(30, 40);
+  S21SparseMatrix sa(a), sb(b, S21SparseFormat::kCsc);
+  EXPECT_TRUE((sa + sb).ToDense() == a + b);
+  EXPECT_TRUE((sa - sb).ToDense() == a - b);
+  EXPECT_EQ((sa + sb).GetFormat(), S21SparseFormat::kCsr);
+  EXPECT_EQ((sa - sa).NonZeros(), 0u);
+  EXPECT_TRUE((sa * 2.5).ToDense() == a * 2.5);
+  EXPECT_EQ((0.0 * sa).NonZeros(), 0u);
+  EXPECT_FALSE(sa == sb);
+  EXPECT_TRUE(S21SparseMatrix() == S21SparseMatrix());
+  EXPECT_THROW(sa += S21SparseMatrix(30, 41), std::invalid_argument);
+  S21SparseMatrix moved = std::move(sa);
+  EXPECT_EQ(moved.GetRows(), 30);
+  EXPECT_EQ(sa.GetRows(), 0);
+}
+
+/*=======| Линейные системы |=======*/
+
+S21Matrix RegularMatrix(int n) {
+  S21Matrix matrix(n, n);
+  FillMatrix(matrix);
+  for (int i = 0; i < n; i++) {
+    matrix(i, i) += 20 * n;
+  }
+  return matrix;
+}
+
+TEST(Solve, MatchesRightHandSide) {
+  for (int n : {1, 3, 70, 130}) {
+    S21Matrix a = RegularMatrix(n), b(n, 7);
+    FillMatrix(b);
+    S21Matrix x = a.Solve(b);
+    EXPECT_EQ(x.GetCols(), 7);
+    EXPECT_TRUE(NaiveProduct(a, x) == b);
+    S21Matrix wide(7, n);
+    FillMatrix(wide);
+    EXPECT_TRUE(NaiveProduct(a, a.Solve(wide.TransposedView())) ==
+                wide.Transpose());
+  }
+}
+
+TEST(Solve, ReusedFactorization) {
+  S21Matrix a = RegularMatrix(90), original = a;
+  S21LuFactorization lu(a);
+  EXPECT_EQ(lu.GetSize(), 90);
+  a = RegularMatrix(90);
+  for (int step = 0; step < 3; step++) {
+    std::vector<double> b(90);
+    for (double& value : b) value = rand() % 9 - 4;
+    std::vector<double> x = b;
+    lu.SolveInPlace(x);
+    EXPECT_EQ(lu.Solve(b), x);
+    S21Matrix column(90, 1);
+    for (int i = 0; i < 90; i++) column(i, 0) = x[i];
+    S21Matrix product = NaiveProduct(original, column);
+    for (int i = 0; i < 90; i++) EXPECT_NEAR(product(i, 0), b[i], 1e-9);
+  }
+  S21Matrix rhs(90, 4);
+  FillMatrix(rhs);
+  S21Matrix x = lu.Solve(rhs);
+  lu.SolveInPlace(rhs);
+  EXPECT_TRUE(rhs == x);
+}
+
+TEST(Solve, DeterminantAndInverse) {
+  S21Matrix a = RegularMatrix(40);
+  S21LuFactorization lu(a);
+  EXPECT_NEAR(lu.Determinant() / a.Determinant(), 1.0, 1e-12);
+  EXPECT_TRUE(lu.Inverse() == a.InverseMatrix());
+  S21Matrix swap(2, 2);
+  swap(0, 1) = 1.0;
+  swap(1, 0) = 1.0;
+  EXPECT_EQ(S21LuFactorization(swap).Determinant(), -1.0);
+}
+
+TEST(Solve, Errors) {
+  S21Matrix singular = RegularMatrix(50);
+  for (int j = 0; j < 50; j++) {
+    singular(49, j) = singular(0, j) - singular(1, j);
+  }
+  EXPECT_THROW(S21LuFactorization lu(singular), std::invalid_argument);
+  EXPECT_THROW(singular.Solve(S21Matrix(50, 1)), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(3, 4).Solve(S21Matrix(3, 1)), std::invalid_argument);
+  S21LuFactorization lu(RegularMatrix(5));
+  EXPECT_THROW(lu.Solve(S21Matrix(4, 1)), std::invalid_argument);
+  EXPECT_THROW(lu.Solve(std::vector<double>(6)), std::invalid_argument);
+  S21Matrix wrong(6, 2);
+  EXPECT_THROW(lu.SolveInPlace(wrong), std::invalid_argument);
+}
+
+/*=======| Разложение Холецкого |=======*/
+
+S21Matrix PositiveDefinite(int n) {
+  S21Matrix b(n, n), res;
+  FillMatrix(b);
+  S21Matrix::Syrk(S21Transpose::kNone, 1.0, b, 0.0, res);
+  for (int i = 0; i < n; i++) {
+    res(i, i) += n;
+  }
+  return res;
+}
+
+TEST(Cholesky, FactorAndSolve) {
+  for (int n : {1, 5, 64, 150}) {
+    S21Matrix a = PositiveDefinite(n);
+    S21CholeskyFactorization cholesky(a);
+    const S21Matrix& l = cholesky.GetFactor();
+    EXPECT_EQ(l(0, n - 1), n == 1 ? l(0, 0) : 0.0);
+    EXPECT_TRUE(NaiveProduct(l, l.Transpose()) == a);
+    S21Matrix b(n, 9);
+    FillMatrix(b);
+    EXPECT_TRUE(NaiveProduct(a, cholesky.Solve(b)) == b);
+    std::vector<double> v(n), x(n);
+    for (int i = 0; i < n; i++) v[i] = b(i, 0);
+    x = cholesky.Solve(v);
+    S21Matrix column = cholesky.Solve(b.Block(0, 0, n, 1));
+    for (int i = 0; i < n; i++) EXPECT_NEAR(x[i], column(i, 0), 1e-12);
+    cholesky.SolveInPlace(v);
+    EXPECT_EQ(v, x);
+  }
+}
+
+TEST(Cholesky, InverseAndLogDeterminant) {
+  S21Matrix a = PositiveDefinite(80);
+  S21CholeskyFactorization cholesky(a);
+  EXPECT_TRUE(cholesky.Inverse() == a.InverseMatrix());
+  S21LuFactorization lu(a);
+  EXPECT_NEAR(cholesky.LogDeterminant(), log(lu.Determinant()), 1e-9);
+  S21Matrix huge(300, 300);
+  for (int i = 0; i < 300; i++) huge(i, i) = 1e3;
+  EXPECT_NEAR(S21CholeskyFactorization(huge).LogDeterminant(),
+              300 * log(1e3), 1e-9);
+  S21SymmetricMatrix packed(a);
+  EXPECT_TRUE(S21CholeskyFactorization(packed).GetFactor() ==
+              cholesky.GetFactor());
+}
+
+TEST(Cholesky, Errors) {
+  S21Matrix indefinite = PositiveDefinite(100);
+  indefinite(70, 70) = -1.0;
+  EXPECT_THROW(S21CholeskyFactorization c(indefinite), std::invalid_argument);
+  S21Matrix semidefinite(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) semidefinite(i, j) = 1.0;
+  }
+  EXPECT_THROW(S21CholeskyFactorization c(semidefinite),
+               std::invalid_argument);
+  S21Matrix asymmetric = PositiveDefinite(4);
+  asymmetric(0, 3) += 1.0;
+  EXPECT_THROW(S21CholeskyFactorization c(asymmetric), std::invalid_argument);
+  EXPECT_THROW(S21CholeskyFactorization c(S21Matrix(2, 3)),
+               std::invalid_argument);
+  EXPECT_THROW(S21CholeskyFactorization c{S21SymmetricMatrix()},
+               std::invalid_argument);
+  S21CholeskyFactorization cholesky(PositiveDefinite(6));
+  EXPECT_THROW(cholesky.Solve(S21Matrix(5, 2)), std::invalid_argument);
+  std::vector<double> wrong(7);
+  EXPECT_THROW(cholesky.SolveInPlace(wrong), std::invalid_argument);
+}
+
+TEST(Cholesky, SymmetryIsRelative) {
+  // A^T A with entries around 1e6 carries rounding far above 1e-7.
+  S21Matrix a = PositiveDefinite(4) * 1e3;
+  a(0, 3) += 1e-3;
+  EXPECT_NO_THROW(S21CholeskyFactorization c(a));
+  a(0, 3) += 1e2;
+  EXPECT_THROW(S21CholeskyFactorization c(a), std::invalid_argument);
+}
+
+/*=======| QR и наименьшие квадраты |=======*/
+
+TEST(Qr, Factors) {
+  const int shapes[][2] = {{1, 1}, {5, 3}, {100, 40}, {300, 70}, {64, 64}};
+  for (const auto& shape : shapes) {
+    const int m = shape[0], n = shape[1];
+    S21Matrix a(m, n);
+    FillMatrix(a);
+    S21QrFactorization qr(a);
+    S21Matrix q = qr.GetQ(), r = qr.GetR();
+    EXPECT_EQ(q.GetRows(), m);
+    EXPECT_EQ(r.GetRows(), n);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < i; j++) EXPECT_EQ(r(i, j), 0.0);
+    }
+    S21Matrix identity(n, n);
+    for (int i = 0; i < n; i++) identity(i, i) = 1.0;
+    EXPECT_TRUE(NaiveProduct(q.Transpose(), q) == identity);
+    EXPECT_TRUE(NaiveProduct(q, r) == a);
+  }
+}
+
+TEST(Qr, LeastSquares) {
+  S21Matrix a(500, 45), x(45, 3);
+  FillMatrix(a);
+  FillMatrix(x);
+  S21Matrix b = NaiveProduct(a, x);
+  EXPECT_TRUE(S21Matrix::LeastSquares(a, b) == x);
+  for (int i = 0; i < 500; i++) b(i, 0) += rand() % 3 - 1;
+  S21Matrix fit = S21Matrix::LeastSquares(a, b);
+  EXPECT_EQ(fit.GetRows(), 45);
+  S21Matrix residual = NaiveProduct(a, fit) - b;
+  S21Matrix gradient = NaiveProduct(a.Transpose(), residual);
+  for (int j = 0; j < 45; j++) EXPECT_NEAR(gradient(j, 0), 0.0, 1e-7);
+  S21QrFactorization qr(a);
+  std::vector<double> column(500);
+  for (int i = 0; i < 500; i++) column[i] = b(i, 0);
+  std::vector<double> solution = qr.Solve(column);
+  ASSERT_EQ(solution.size(), 45u);
+  for (int j = 0; j < 45; j++) EXPECT_NEAR(solution[j], fit(j, 0), 1e-9);
+  S21Matrix wide(45, 500);
+  FillMatrix(wide);
+  EXPECT_TRUE(S21QrFactorization(wide.TransposedView()).GetR() ==
+              S21QrFactorization(wide.Transpose()).GetR());
+}
+
+TEST(Qr, Errors) {
+  EXPECT_THROW(S21QrFactorization(S21Matrix(3, 4)), std::invalid_argument);
+  S21Matrix dependent(10, 3);
+  FillMatrix(dependent);
+  for (int i = 0; i < 10; i++) dependent(i, 2) = 2 * dependent(i, 0);
+  S21QrFactorization qr(dependent);
+  EXPECT_NEAR(qr.GetR()(2, 2), 0.0, 1e-12);
+  EXPECT_THROW(qr.Solve(S21Matrix(10, 1)), std::invalid_argument);
+  S21QrFactorization full(RegularMatrix(10));
+  EXPECT_THROW(full.Solve(S21Matrix(9, 1)), std::invalid_argument);
+  EXPECT_THROW(full.Solve(std::vector<double>(11)), std::invalid_argument);
+}
+
 /*==========================| Сеттеры и геттеры |============================*/
 
 /*=======| SetRows |=======*/
@@ -908,6 +2015,16 @@ TEST(SetRows, ZeroValue) {
   ASSERT_THROW(matrix.SetRows(0), std::out_of_range);
 }
 
+TEST(SetRows, KeepsValues) {
+  S21Matrix matrix(2, 3);
+  FillMatrix(matrix);
+  S21Matrix copy(matrix);
+  matrix.SetRows(4);
+  matrix.SetRows(2);
+
+  ASSERT_TRUE(matrix == copy);
+}
+
 /*=======| SetCols |=======*/
 
 TEST(SetCols, PositiveValue) {
@@ -926,6 +2043,17 @@ TEST(SetCols, ZeroValue) {
   ASSERT_THROW(matrix.SetCols(0), std::out_of_range);
 }
 
+TEST(SetCols, KeepsValues) {
+  S21Matrix matrix(3, 9);
+  FillMatrix(matrix);
+  S21Matrix copy(matrix);
+  matrix.SetCols(17);
+  ASSERT_EQ(matrix(2, 16), 0);
+  matrix.SetCols(9);
+
+  ASSERT_TRUE(matrix == copy);
+}
+
 /*=======| GetRows |=======*/
 
 TEST(S21MatrixTest, GetRows) {
@@ -941,6 +2069,612 @@ TEST(S21MatrixTest, GetCols) {
   ASSERT_EQ(matrix.GetCols(), 3);
 }
 
+/*==========================| Многопоточность |============================*/
+
+TEST(ThreadCount, SetAndGet) {
+  int saved = S21Matrix::GetThreadCount();
+  S21Matrix::SetThreadCount(3);
+  EXPECT_EQ(S21Matrix::GetThreadCount(), 3);
+  EXPECT_THROW(S21Matrix::SetThreadCount(0), std::invalid_argument);
+  S21Matrix::SetThreadCount(saved);
+}
+
+TEST(ThreadCount, ParallelResultsMatchSerial) {
+  int saved = S21Matrix::GetThreadCount();
+  S21Matrix matrix1(301, 257);
+  S21Matrix matrix2(257, 190);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  S21Matrix::SetThreadCount(1);
+  S21Matrix product = matrix1 * matrix2;
+  S21Matrix sum = matrix1 + matrix1 * 0.5;
+  S21Matrix transposed = matrix1.Transpose();
+
+  S21Matrix::SetThreadCount(4);
+  EXPECT_TRUE(matrix1 * matrix2 == product);
+  EXPECT_TRUE(matrix1 + matrix1 * 0.5 == sum);
+  EXPECT_TRUE(matrix1.Transpose() == transposed);
+  S21Matrix::SetThreadCount(saved);
+}
+
+/*==========================| SIMD |============================*/
+
+const S21SimdTarget kSimdTargets[] = {S21SimdTarget::kScalar,
+                                      S21SimdTarget::kSse2,
+                                      S21SimdTarget::kAvx2,
+                                      S21SimdTarget::kAvx512};
+
+TEST(Simd, ScalarAlwaysSupported) {
+  EXPECT_TRUE(S21Matrix::SimdSupported(S21SimdTarget::kScalar));
+  EXPECT_TRUE(S21Matrix::SimdSupported(S21Matrix::GetSimdTarget()));
+}
+
+TEST(Simd, EveryTargetMatchesReference) {
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  const int sizes[][2] = {{1, 1}, {3, 5}, {9, 7}, {37, 45}, {66, 19}};
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) {
+      EXPECT_THROW(S21Matrix::SetSimdTarget(target), std::invalid_argument);
+      continue;
+    }
+    S21Matrix::SetSimdTarget(target);
+    EXPECT_EQ(S21Matrix::GetSimdTarget(), target);
+    for (const auto &size : sizes) {
+      const int rows = size[0], cols = size[1];
+      S21Matrix a(rows, cols), b(rows, cols);
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+          a(i, j) = i * 0.5 - j * 1.25;
+          b(i, j) = (i + 1) * (j + 2) * 0.125;
+        }
+      }
+      S21Matrix sum(a), diff(a), scaled(a);
+      sum.SumMatrix(b);
+      diff.SubMatrix(b);
+      scaled.MulNumber(-3.0);
+      S21Matrix transposed = a.Transpose();
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+          ASSERT_DOUBLE_EQ(sum(i, j), a(i, j) + b(i, j));
+          ASSERT_DOUBLE_EQ(diff(i, j), a(i, j) - b(i, j));
+          ASSERT_DOUBLE_EQ(scaled(i, j), a(i, j) * -3.0);
+          ASSERT_DOUBLE_EQ(transposed(j, i), a(i, j));
+        }
+      }
+      S21Matrix near(a);
+      near(rows - 1, cols - 1) += eps / 2;
+      EXPECT_TRUE(a.EqMatrix(near));
+      near(rows - 1, cols - 1) += eps;
+      EXPECT_FALSE(a.EqMatrix(near));
+      near = a;
+      near(0, 0) -= 2 * eps;
+      EXPECT_FALSE(a.EqMatrix(near));
+    }
+  }
+  S21Matrix::SetSimdTarget(saved);
+}
+
+TEST(Simd, EveryTargetMultiplies) {
+  // Each target has its own GEMM tile; odd shapes leave partial tiles.
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  const S21GemmBlocking blocking = S21Matrix::GetGemmBlocking();
+  const int shapes[][3] = {{67, 91, 53}, {150, 130, 170}, {13, 300, 7}};
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) continue;
+    S21Matrix::SetSimdTarget(target);
+    for (const auto& shape : shapes) {
+      S21Matrix a(shape[0], shape[1]), b(shape[1], shape[2]);
+      FillMatrix(a);
+      FillMatrix(b);
+      const S21Matrix expected = NaiveProduct(a, b);
+      EXPECT_TRUE(a * b == expected);
+      S21Matrix::SetGemmBlocking({6, 5, 10});
+      EXPECT_TRUE(a * b == expected);
+      S21Matrix::SetGemmBlocking(blocking);
+    }
+  }
+  S21Matrix::SetSimdTarget(saved);
+}
+
+/*==========================| Типы элементов |============================*/
+
+TEST(BasicMatrix, DoubleAlias) {
+  EXPECT_TRUE((std::is_same_v<S21Matrix, S21BasicMatrix<double>>));
+  EXPECT_DOUBLE_EQ(S21Tolerance<double>::kValue, eps);
+}
+
+TEST(BasicMatrix, FloatArithmetic) {
+  S21BasicMatrix<float> a(2, 3), b(3, 2);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      a(i, j) = i + j * 0.5f;
+      b(j, i) = i - j;
+    }
+  }
+  S21BasicMatrix<float> product = a * b;
+  EXPECT_FLOAT_EQ(product(0, 0), -2.5f);
+  EXPECT_FLOAT_EQ(product(1, 1), -1.0f);
+  S21BasicMatrix<float> sum = a + a - a * 2.0f;
+  EXPECT_FLOAT_EQ(sum(1, 2), 0.0f);
+  S21BasicMatrix<float> near(a);
+  near(0, 0) += 5e-06f;
+  EXPECT_TRUE(near == a);
+  near(0, 0) += 1e-04f;
+  EXPECT_FALSE(near == a);
+}
+
+TEST(BasicMatrix, FloatInverse) {
+  S21BasicMatrix<float> matrix(3, 3);
+  const float values[3][3] = {{2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      matrix(i, j) = values[i][j];
+    }
+  }
+  EXPECT_NEAR(matrix.Determinant(), -1.0f, 1e-05f);
+  S21BasicMatrix<float> inverse = matrix.InverseMatrix();
+  EXPECT_NEAR(inverse(0, 0), 1.0f, 1e-04f);
+  EXPECT_NEAR(inverse(2, 2), 24.0f, 1e-03f);
+  EXPECT_THROW(S21BasicMatrix<float>(2, 2).InverseMatrix(),
+               std::invalid_argument);
+}
+
+// Float copy of a double matrix with small integer entries, on which the
+// float kernels are exact.
+S21BasicMatrix<float> ToFloat(const S21Matrix& matrix) {
+  S21BasicMatrix<float> res(matrix.GetRows(), matrix.GetCols());
+  for (int i = 0; i < matrix.GetRows(); i++) {
+    for (int j = 0; j < matrix.GetCols(); j++) {
+      res(i, j) = static_cast<float>(matrix(i, j));
+    }
+  }
+  return res;
+}
+
+TEST(BasicMatrix, FloatKernels) {
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  S21Matrix a(67, 45), b(45, 133), c(67, 45);
+  FillMatrix(a);
+  FillMatrix(b);
+  FillMatrix(c);
+  const S21BasicMatrix<float> fa = ToFloat(a), fb = ToFloat(b),
+                              fc = ToFloat(c);
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) continue;
+    S21Matrix::SetSimdTarget(target);
+    EXPECT_TRUE(fa * fb == ToFloat(a * b));
+    EXPECT_TRUE(fb.Transpose() == ToFloat(b.Transpose()));
+    EXPECT_TRUE((fa + fc) * 3.0f - fc == ToFloat((a + c) * 3.0 - c));
+    S21BasicMatrix<float> near(fa);
+    near(66, 44) += 5e-06f;
+    EXPECT_TRUE(near == fa);
+    near(66, 44) += 1e-04f;
+    EXPECT_FALSE(near == fa);
+  }
+  S21Matrix::SetSimdTarget(saved);
+}
+
+TEST(BasicMatrix, FloatFactorizations) {
+  // Diagonal near 1, so the determinant stays within float range.
+  const S21Matrix matrix = RegularMatrix(150) * (1.0 / 3000);
+  const S21BasicMatrix<float> fmatrix = ToFloat(matrix);
+  EXPECT_NEAR(fmatrix.Determinant() / matrix.Determinant(), 1.0, 1e-03);
+  const S21BasicMatrix<float> inverse = fmatrix.InverseMatrix();
+  const S21Matrix expected = matrix.InverseMatrix();
+  for (int i = 0; i < 150; i++) {
+    for (int j = 0; j < 150; j++) {
+      EXPECT_NEAR(inverse(i, j), expected(i, j), 1e-05);
+    }
+  }
+}
+
+TEST(BasicMatrix, IntegerExact) {
+  const int n = 12;
+  S21BasicMatrix<std::int64_t> matrix(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      matrix(i, j) = i == j ? 2 : (j == i + 1 || i == j + 1 ? -1 : 0);
+    }
+  }
+  // Tridiagonal [-1, 2, -1] has determinant n + 1.
+  EXPECT_EQ(matrix.Determinant(), n + 1);
+  S21BasicMatrix<std::int64_t> complements = matrix.CalcComplements();
+  S21BasicMatrix<std::int64_t> product = matrix * complements.Transpose();
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      EXPECT_EQ(product(i, j), i == j ? n + 1 : 0);
+    }
+  }
+  EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(BasicMatrix, IntegerComplements) {
+  const int n = 9;
+  S21BasicMatrix<std::int64_t> matrix(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      matrix(i, j) = rand() % 11 - 5;
+    }
+  }
+  // Zero pivots force row swaps in the elimination.
+  matrix(0, 0) = matrix(1, 1) = 0;
+  const std::int64_t determinant = matrix.Determinant();
+  ASSERT_NE(determinant, 0);
+  S21BasicMatrix<std::int64_t> product =
+      matrix * matrix.CalcComplements().Transpose();
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      EXPECT_EQ(product(i, j), i == j ? determinant : 0);
+    }
+  }
+  // Rank n - 1: the cofactor fallback, with a nonzero adjugate.
+  for (int j = 0; j < n; j++) {
+    matrix(n - 1, j) = matrix(0, j) + matrix(1, j);
+  }
+  S21BasicMatrix<std::int64_t> complements = matrix.CalcComplements();
+  S21BasicMatrix<std::int64_t> zero(n, n);
+  EXPECT_TRUE(matrix * complements.Transpose() == zero);
+  EXPECT_FALSE(complements == zero);
+}
+
+TEST(BasicMatrix, FloatingComplements) {
+  // Diagonal near 1, so the determinant stays within float range.
+  S21BasicMatrix<float> matrix = ToFloat(RegularMatrix(40) * (1.0 / 800));
+  const float determinant = matrix.Determinant();
+  S21BasicMatrix<float> product =
+      matrix * matrix.CalcComplements().Transpose();
+  for (int i = 0; i < 40; i++) {
+    for (int j = 0; j < 40; j++) {
+      EXPECT_NEAR(product(i, j) / determinant, i == j ? 1.0f : 0.0f, 1e-05f);
+    }
+  }
+  for (int j = 0; j < 40; j++) {
+    matrix(39, j) = matrix(0, j) - matrix(1, j);
+  }
+  S21BasicMatrix<float> singular_product =
+      matrix * matrix.CalcComplements().Transpose();
+  EXPECT_TRUE(singular_product == S21BasicMatrix<float>(40, 40));
+  using Complex = std::complex<double>;
+  S21BasicMatrix<Complex> singular(3, 3);
+  for (int i = 0; i < 3; i++) {
+    singular(0, i) = Complex(i + 1, 1);
+    singular(1, i) = Complex(2 - i, i);
+    singular(2, i) = singular(0, i) * Complex(0, 2);
+  }
+  S21BasicMatrix<Complex> adjugate = singular.CalcComplements().Transpose();
+  EXPECT_TRUE(singular * adjugate == S21BasicMatrix<Complex>(3, 3));
+  EXPECT_GT(std::abs(adjugate(0, 1)) + std::abs(adjugate(1, 0)), 1.0);
+}
+
+TEST(BasicMatrix, IntegerUnimodularInverse) {
+  S21BasicMatrix<std::int64_t> matrix(3, 3);
+  const std::int64_t values[3][3] = {{2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      matrix(i, j) = values[i][j];
+    }
+  }
+  S21BasicMatrix<std::int64_t> identity(3, 3);
+  for (int i = 0; i < 3; i++) {
+    identity(i, i) = 1;
+  }
+  EXPECT_TRUE(matrix * matrix.InverseMatrix() == identity);
+}
+
+TEST(BasicMatrix, ComplexDeterminantAndInverse) {
+  using Complex = std::complex<double>;
+  S21BasicMatrix<Complex> matrix(2, 2);
+  matrix(0, 0) = Complex(1, 1);
+  matrix(0, 1) = Complex(2, 0);
+  matrix(1, 0) = Complex(0, -1);
+  matrix(1, 1) = Complex(3, 2);
+  const Complex determinant = matrix.Determinant();
+  EXPECT_NEAR(determinant.real(), 1.0, 1e-12);
+  EXPECT_NEAR(determinant.imag(), 7.0, 1e-12);
+  S21BasicMatrix<Complex> identity(2, 2);
+  identity(0, 0) = identity(1, 1) = Complex(1, 0);
+  EXPECT_TRUE(matrix * matrix.InverseMatrix() == identity);
+  EXPECT_TRUE(matrix.Transpose().Transpose() == matrix);
+}
+
+TEST(BasicMatrix, DimensionErrors) {
+  S21BasicMatrix<float> a(2, 3), b(3, 3);
+  EXPECT_THROW(a + b, std::invalid_argument);
+  EXPECT_THROW(a.Determinant(), std::invalid_argument);
+  EXPECT_THROW(a(2, 0), std::out_of_range);
+  EXPECT_THROW(S21BasicMatrix<std::int64_t>(0, 1), std::out_of_range);
+  a.SetCols(4);
+  EXPECT_EQ(a.GetCols(), 4);
+}
+
+/*==========================| Фиксированный размер |======================*/
+
+template <typename L, typename R, typename = void>
+struct CanMultiply : std::false_type {};
+
+template <typename L, typename R>
+struct CanMultiply<L, R,
+                   std::void_t<decltype(std::declval<L>() * std::declval<R>())>>
+    : std::true_type {};
+
+template <typename L, typename R, typename = void>
+struct CanAdd : std::false_type {};
+
+template <typename L, typename R>
+struct CanAdd<L, R,
+              std::void_t<decltype(std::declval<L>() + std::declval<R>())>>
+    : std::true_type {};
+
+TEST(FixedMatrix, Constexpr) {
+  constexpr S21FixedMatrix<3, 3> matrix(2, 5, 7, 6, 3, 4, 5, -2, -3);
+  static_assert(matrix.Determinant() == -1.0);
+  static_assert(matrix.Transpose()(0, 2) == 5.0);
+  static_assert((matrix * S21FixedMatrix<3, 3>::Identity()) == matrix);
+  constexpr S21FixedMatrix<3, 3> inverse = matrix.InverseMatrix();
+  static_assert(inverse(1, 0) == -38.0);
+  static_assert(sizeof(S21FixedMatrix<4, 4>) == 16 * sizeof(double));
+  EXPECT_DOUBLE_EQ(inverse(2, 2), 24.0);
+}
+
+TEST(FixedMatrix, ShapesCheckedAtCompileTime) {
+  using M23 = S21FixedMatrix<2, 3>;
+  using M32 = S21FixedMatrix<3, 2>;
+  static_assert(CanMultiply<M23, M32>::value);
+  static_assert(!CanMultiply<M23, M23>::value);
+  static_assert(CanAdd<M23, M23>::value);
+  static_assert(!CanAdd<M23, M32>::value);
+  static_assert(std::is_same_v<decltype(M23() * M32()), S21FixedMatrix<2, 2>>);
+  SUCCEED();
+}
+
+TEST(FixedMatrix, MatchesDynamicMatrix) {
+  S21Matrix dynamic(4, 4);
+  FillMatrix(dynamic);
+  for (int i = 0; i < 4; i++) {
+    dynamic(i, i) += 50;
+  }
+  const S21FixedMatrix<4, 4> fixed(dynamic);
+  EXPECT_NEAR(fixed.Determinant(), dynamic.Determinant(), 1e-06);
+  EXPECT_TRUE(S21Matrix(fixed.InverseMatrix()) == dynamic.InverseMatrix());
+  EXPECT_TRUE(S21Matrix(fixed.CalcComplements()) == dynamic.CalcComplements());
+  EXPECT_TRUE(S21Matrix(fixed * fixed - 2.0 * fixed) ==
+              dynamic * dynamic - dynamic * 2.0);
+  S21FixedMatrix<4, 4> accumulated(fixed);
+  accumulated *= fixed;
+  accumulated += fixed;
+  EXPECT_TRUE(S21Matrix(accumulated) == dynamic * dynamic + dynamic);
+  EXPECT_THROW((S21FixedMatrix<3, 4>(dynamic)), std::invalid_argument);
+}
+
+TEST(FixedMatrix, LargerDeterminantAndSingular) {
+  S21FixedMatrix<5, 5> matrix;
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      matrix(i, j) = i == j ? 2.0 : 1.0;
+    }
+  }
+  EXPECT_NEAR(matrix.Determinant(), 6.0, 1e-12);
+  const S21FixedMatrix<2, 2> singular(1, 2, 2, 4);
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  constexpr S21FixedMatrix<2, 2, long> integers(1, 2, 3, 4);
+  static_assert(integers.Determinant() == -2);
+}
+
+TEST(FixedMatrix, SingularityMatchesDynamicMatrix) {
+  // Small-unit transforms invert; a negligible pivot is singular in both.
+  S21Matrix dynamic(3, 3), negligible(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) dynamic(i, j) = (i == j ? 4.0 : 1.0) * 1e-3;
+    negligible(i, i) = i < 2 ? 1.0 : 1e-8;
+  }
+  const S21FixedMatrix<3, 3> fixed(dynamic);
+  EXPECT_TRUE(S21Matrix(fixed.InverseMatrix()) == dynamic.InverseMatrix());
+  EXPECT_DOUBLE_EQ((S21FixedMatrix<3, 3>::Identity() * 1e-3)
+                       .InverseMatrix()(2, 2),
+                   1e3);
+  EXPECT_THROW(negligible.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW((S21FixedMatrix<3, 3>(negligible).InverseMatrix()),
+               std::invalid_argument);
+}
+
+/*==========================| Пакеты матриц |=============================*/
+
+S21MatrixBatch RandomBatch(int count, int rows, int cols) {
+  S21MatrixBatch batch(count, rows, cols);
+  for (int k = 0; k < count; k++) {
+    S21Matrix matrix(rows, cols);
+    FillMatrix(matrix);
+    if (rows == cols) {
+      for (int i = 0; i < rows; i++) matrix(i, i) += 10 * rows;
+    }
+    batch.Set(k, matrix);
+  }
+  return batch;
+}
+
+TEST(MatrixBatch, Elements) {
+  S21MatrixBatch batch(13, 2, 3);
+  EXPECT_EQ(batch.GetCount(), 13);
+  EXPECT_EQ(batch(12, 1, 2), 0.0);
+  batch(9, 1, 2) = 4.5;
+  S21Matrix matrix(2, 3);
+  FillMatrix(matrix);
+  batch.Set(12, matrix);
+  EXPECT_TRUE(batch.Get(12) == matrix);
+  EXPECT_EQ(batch.Get(9)(1, 2), 4.5);
+  EXPECT_EQ(batch.Get(8)(1, 2), 0.0);
+  EXPECT_THROW(batch(13, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch.Get(-1), std::out_of_range);
+  EXPECT_THROW(batch.Set(0, S21Matrix(3, 2)), std::invalid_argument);
+  EXPECT_THROW(S21MatrixBatch(0, 2, 2), std::out_of_range);
+  S21MatrixBatch moved = std::move(batch);
+  EXPECT_EQ(moved.Get(9)(1, 2), 4.5);
+  EXPECT_EQ(batch.GetCount(), 0);
+}
+
+TEST(MatrixBatch, Multiply) {
+  const int shapes[][3] = {{4, 4, 4}, {6, 6, 6}, {3, 5, 2}};
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) continue;
+    S21Matrix::SetSimdTarget(target);
+    for (const auto& shape : shapes) {
+      S21MatrixBatch a = RandomBatch(21, shape[0], shape[1]);
+      S21MatrixBatch b = RandomBatch(21, shape[1], shape[2]);
+      S21MatrixBatch product = a * b;
+      EXPECT_EQ(product.GetCols(), shape[2]);
+      for (int k = 0; k < 21; k++) {
+        EXPECT_TRUE(product.Get(k) == NaiveProduct(a.Get(k), b.Get(k)));
+      }
+      S21MatrixBatch::Multiply(a, b, a);
+      EXPECT_TRUE(a.Get(20) == product.Get(20));
+    }
+  }
+  S21Matrix::SetSimdTarget(saved);
+  EXPECT_THROW(RandomBatch(3, 2, 2) * RandomBatch(4, 2, 2),
+               std::invalid_argument);
+  EXPECT_THROW(RandomBatch(3, 2, 3) * RandomBatch(3, 2, 3),
+               std::invalid_argument);
+}
+
+TEST(MatrixBatch, DeterminantAndInverse) {
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) continue;
+    S21Matrix::SetSimdTarget(target);
+    for (int n : {1, 4, 6, 17}) {
+      S21MatrixBatch batch = RandomBatch(19, n, n);
+      S21Matrix permuted(n, n);
+      for (int i = 0; i < n; i++) permuted(i, n - 1 - i) = i + 2.0;
+      batch.Set(5, permuted);
+      std::vector<double> det = batch.Determinant();
+      ASSERT_EQ(det.size(), 19u);
+      S21MatrixBatch inverse = batch.InverseMatrix();
+      for (int k = 0; k < 19; k++) {
+        const double expected = batch.Get(k).Determinant();
+        EXPECT_NEAR(det[k], expected, 1e-9 * fabs(expected));
+        EXPECT_TRUE(inverse.Get(k) == batch.Get(k).InverseMatrix());
+      }
+    }
+  }
+  S21Matrix::SetSimdTarget(saved);
+  S21MatrixBatch batch = RandomBatch(10, 3, 3);
+  S21Matrix singular(3, 3);
+  for (int j = 0; j < 3; j++) singular(1, j) = singular(2, j) = j + 1.0;
+  batch.Set(7, singular);
+  EXPECT_EQ(batch.Determinant()[7], 0.0);
+  EXPECT_THROW(batch.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(RandomBatch(2, 2, 3).Determinant(), std::invalid_argument);
+}
+
+TEST(MatrixBatch, SingularityMatchesInverseMatrix) {
+  // Near the threshold: the last pivot is about 1e-4, 2e-7 or 5e-8 times
+  // max|a|, and diag(1, 1, 1e-4, 1e-4) used to pass only in the batch.
+  std::vector<S21Matrix> cases;
+  for (double last : {1e-4, 2e-7, 5e-8}) {
+    S21Matrix diagonal(4, 4), dense(4, 4);
+    for (int i = 0; i < 4; i++) diagonal(i, i) = i < 2 ? 1.0 : 1e-4;
+    diagonal(3, 3) = last;
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 4; j++) dense(i, j) = (i == j ? 4.0 : 1.0) * 1e3;
+    }
+    for (int j = 0; j < 4; j++) dense(3, j) = dense(0, j) + dense(1, j);
+    dense(3, 3) += 4e3 * last;
+    cases.push_back(diagonal);
+    cases.push_back(dense);
+  }
+  const S21SimdTarget saved = S21Matrix::GetSimdTarget();
+  for (S21SimdTarget target : kSimdTargets) {
+    if (!S21Matrix::SimdSupported(target)) continue;
+    S21Matrix::SetSimdTarget(target);
+    for (std::size_t c = 0; c < cases.size(); c++) {
+      S21MatrixBatch batch(3, 4, 4);
+      batch.Set(1, cases[c]);
+      batch.Set(0, RegularMatrix(4));
+      batch.Set(2, RegularMatrix(4));
+      bool regular = true;
+      try {
+        cases[c].InverseMatrix();
+      } catch (const std::invalid_argument&) {
+        regular = false;
+      }
+      EXPECT_EQ(regular, c < 4) << c;
+      if (regular) {
+        EXPECT_NO_THROW(batch.InverseMatrix()) << c;
+      } else {
+        EXPECT_THROW(batch.InverseMatrix(), std::invalid_argument) << c;
+      }
+    }
+  }
+  S21Matrix::SetSimdTarget(saved);
+}
+
+/*==========================| Память |============================*/
+
+TEST(MemoryResource, DefaultCounters) {
+  S21MemoryResource& resource = S21Matrix::DefaultMemoryResource();
+  std::size_t blocks = resource.BlocksInUse();
+  std::size_t bytes = resource.BytesInUse();
+  {
+    S21Matrix matrix(3, 5);
+    EXPECT_EQ(resource.BlocksInUse(), blocks + 1);
+    EXPECT_GE(resource.BytesInUse(), bytes + 15 * sizeof(double));
+  }
+  EXPECT_EQ(resource.BlocksInUse(), blocks);
+  EXPECT_EQ(resource.BytesInUse(), bytes);
+}
+
+TEST(MemoryResource, PoolReusesBlocks) {
+  S21PoolResource pool;
+  S21MemoryResourceScope scope(&pool);
+  const double* first = nullptr;
+  {
+    S21Matrix matrix(10, 10);
+    first = &matrix(0, 0);
+    EXPECT_EQ(pool.BlocksInUse(), 1u);
+  }
+  S21Matrix matrix(10, 10);
+  EXPECT_EQ(&matrix(0, 0), first);
+  EXPECT_EQ(pool.BlocksInUse(), 1u);
+}
+
+TEST(MemoryResource, ArenaReset) {
+  S21ArenaResource arena(4096);
+  S21Matrix outside(2, 2);
+  {
+    S21MemoryResourceScope scope(&arena);
+    S21Matrix matrix1(8, 8), matrix2(30, 30);
+    FillMatrix(matrix1);
+    S21Matrix sum = matrix1 + matrix1;
+    EXPECT_EQ(arena.BlocksInUse(), 3u);
+    EXPECT_THROW(arena.Reset(), std::logic_error);
+    outside = std::move(sum);
+  }
+  EXPECT_EQ(S21Matrix::GetMemoryResource(),
+            &S21Matrix::DefaultMemoryResource());
+  EXPECT_EQ(arena.BlocksInUse(), 1u);
+  outside = S21Matrix(2, 2);
+  EXPECT_EQ(arena.BlocksInUse(), 0u);
+  EXPECT_NO_THROW(arena.Reset());
+}
+
+TEST(MemoryResource, StrassenScratch) {
+  // The inner pool caches what it frees, so the outer one still counts the
+  // Winograd temporaries once the product is done.
+  S21PoolResource upstream;
+  S21PoolResource pool(std::size_t(1) << 22, &upstream);
+  S21MemoryResourceScope scope(&pool);
+  S21Matrix::SetStrassenCrossover(16);
+  S21Matrix matrix1(64, 64), matrix2(64, 64), result(64, 64);
+  FillMatrix(matrix1);
+  FillMatrix(matrix2);
+  S21Matrix::Multiply(matrix1, matrix2, result);
+  S21Matrix::SetStrassenCrossover(0);
+  EXPECT_EQ(pool.BlocksInUse(), 3u);
+  EXPECT_GT(upstream.BlocksInUse(), 3u);
+  EXPECT_TRUE(result == NaiveProduct(matrix1, matrix2));
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,130 @@
+#include "s21_matrix_view.h"
+
+#include <stdexcept>
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_simd.h"
+
+S21MatrixView::S21MatrixView(const double *data, int rows, int cols,
+                             std::ptrdiff_t row_stride,
+                             std::ptrdiff_t col_stride)
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      row_stride_(row_stride),
+      col_stride_(col_stride) {
+  if (rows_ < 0 || cols_ < 0 || row_stride_ < 0 || col_stride_ < 0) {
+    throw std::out_of_range("Invalid matrix size");
+  }
+}
+
+S21MatrixView::S21MatrixView(const S21Matrix &matrix)
+    : S21MatrixView(matrix.matrix_, matrix.rows_, matrix.cols_, matrix.ld_,
+                    1) {}
+
+S21MatrixView S21MatrixView::Transpose() const noexcept {
+  S21MatrixView res(*this);
+  std::swap(res.rows_, res.cols_);
+  std::swap(res.row_stride_, res.col_stride_);
+  return res;
+}
+
+S21MatrixView S21MatrixView::Block(int row, int col, int rows,
+                                   int cols) const {
+  CheckBlock(row, col, rows, cols);
+  return S21MatrixView(data_ + Offset(row, col), rows, cols, row_stride_,
+                       col_stride_);
+}
+
+void S21MatrixView::CheckBlock(int row, int col, int rows, int cols) const {
+  if (rows < 0 || cols < 0) throw std::out_of_range("Invalid matrix size");
+  if (row < 0 || col < 0 || row > rows_ - rows || col > cols_ - cols)
+    throw std::out_of_range("Index outside the matrix");
+}
+
+double S21MatrixView::operator()(int i, int j) const {
+  if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
+    throw std::out_of_range("Index outside the matrix");
+  return data_[Offset(i, j)];
+}
+
+bool S21MatrixView::Overlaps(const S21MatrixView &other) const noexcept {
+  if (rows_ == 0 || cols_ == 0 || other.rows_ == 0 || other.cols_ == 0) {
+    return false;
+  }
+  const std::ptrdiff_t ld = row_stride_;
+  if (col_stride_ == 1 && other.col_stride_ == 1 && other.row_stride_ == ld &&
+      cols_ <= ld && other.cols_ <= ld) {
+    // Row-major blocks of one matrix: other starts at (row, col) relative to
+    // this view, and its rows that run past column ld continue at
+    // (row + 1, col - ld).
+    const std::ptrdiff_t offset = other.data_ - data_;
+    std::ptrdiff_t row = offset / ld, col = offset % ld;
+    if (col < 0) {
+      col += ld;
+      row--;
+    }
+    auto intersects = [&](std::ptrdiff_t r, std::ptrdiff_t c) {
+      return r < rows_ && r + other.rows_ > 0 && c < cols_ &&
+             c + other.cols_ > 0;
+    };
+    return intersects(row, col) || intersects(row + 1, col - ld);
+  }
+  const double *last = data_ + Offset(rows_ - 1, cols_ - 1);
+  const double *other_last = other.data_ + other.Offset(other.rows_ - 1,
+                                                        other.cols_ - 1);
+  return data_ <= other_last && other.data_ <= last;
+}
+
+bool S21MatrixView::Aliases(const S21MatrixView &dst) const noexcept {
+  const bool same_layout = data_ == dst.data_ &&
+                           row_stride_ == dst.row_stride_ &&
+                           col_stride_ == dst.col_stride_;
+  return !same_layout && Overlaps(dst);
+}
+
+S21MatrixBlock::S21MatrixBlock(double *data, int rows, int cols,
+                               std::ptrdiff_t row_stride,
+                               std::ptrdiff_t col_stride)
+    : S21MatrixView(data, rows, cols, row_stride, col_stride) {}
+
+S21MatrixBlock S21MatrixBlock::Block(int row, int col, int rows,
+                                     int cols) const {
+  CheckBlock(row, col, rows, cols);
+  return S21MatrixBlock(Data() + Offset(row, col), rows, cols,
+                        GetRowStride(), GetColStride());
+}
+
+double &S21MatrixBlock::operator()(int i, int j) const {
+  if (i < 0 || j < 0 || i >= GetRows() || j >= GetCols())
+    throw std::out_of_range("Index outside the matrix");
+  return Data()[Offset(i, j)];
+}
+
+S21MatrixBlock &S21MatrixBlock::operator=(const S21MatrixBlock &other) {
+  return *this = static_cast<const S21MatrixView &>(other);
+}
+
+S21MatrixBlock &S21MatrixBlock::operator*=(const double num) {
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int i = 0; i < GetRows(); i++) {
+    if (GetColStride() == 1) {
+      simd.scale(Data() + Offset(i, 0), num, GetCols());
+    } else {
+      for (int j = 0; j < GetCols(); j++) {
+        Data()[Offset(i, j)] *= num;
+      }
+    }
+  }
+  return *this;
+}
+
+S21MatrixBlock &S21MatrixBlock::operator*=(const S21MatrixView &other) {
+  if (other.GetRows() != GetCols() || other.GetCols() != GetCols()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21Matrix res;
+  S21Matrix::Multiply(*this, other, res);
+  return *this = res;
+}
@@ -0,0 +1,97 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_VIEW_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_VIEW_H_
+
+#include <cstddef>
+
+#include "s21_matrix_expr.h"
+
+// Non-owning read-only window onto matrix storage: element (i, j) lives at
+// data[i * row_stride + j * col_stride]. Transposing a view swaps its
+// extents and strides, so it is O(1). Views can be used wherever an
+// expression is accepted and are passed to the multiply kernel with their
+// strides, without being copied. A view must not outlive its matrix.
+class S21MatrixView : public S21MatrixExpr<S21MatrixView> {
+ public:
+  S21MatrixView(const double *data, int rows, int cols,
+                std::ptrdiff_t row_stride, std::ptrdiff_t col_stride);
+  S21MatrixView(const S21Matrix &matrix);
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  std::ptrdiff_t GetRowStride() const noexcept { return row_stride_; }
+  std::ptrdiff_t GetColStride() const noexcept { return col_stride_; }
+  const double *Data() const noexcept { return data_; }
+  // True when the columns, not the rows, are the contiguous direction.
+  bool IsTransposed() const noexcept { return col_stride_ > row_stride_; }
+
+  S21MatrixView Transpose() const noexcept;
+  // rows x cols window whose top-left element is (row, col); throws
+  // std::out_of_range unless it lies inside this view.
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  double operator()(int i, int j) const;
+
+  auto ExprRow(int i) const noexcept {
+    return RowType{data_ + i * row_stride_, col_stride_};
+  }
+  // True when the two views share any element.
+  bool Overlaps(const S21MatrixView &other) const noexcept;
+  // True when an elementwise assignment to dst could overwrite elements of
+  // this view before they are read.
+  bool Aliases(const S21MatrixView &dst) const noexcept;
+
+ protected:
+  void CheckBlock(int row, int col, int rows, int cols) const;
+  std::ptrdiff_t Offset(int i, int j) const noexcept {
+    return i * row_stride_ + j * col_stride_;
+  }
+
+ private:
+  struct RowType {
+    double operator[](int j) const { return row[j * stride]; }
+    const double *row;
+    std::ptrdiff_t stride;
+  };
+
+  const double *data_;
+  int rows_, cols_;
+  std::ptrdiff_t row_stride_, col_stride_;
+};
+
+// Writable window onto a matrix, typically S21Matrix::Block(). Copying a
+// block copies the reference; assigning to one writes its elements, so
+// a.Block(0, 0, 2, 2) = b.Block(1, 1, 2, 2) copies a 2 x 2 region. Blocks are
+// views as well and can be passed anywhere a view is accepted. Like a view,
+// a block must not outlive its matrix.
+class S21MatrixBlock : public S21MatrixView {
+ public:
+  S21MatrixBlock(double *data, int rows, int cols, std::ptrdiff_t row_stride,
+                 std::ptrdiff_t col_stride);
+  S21MatrixBlock(const S21MatrixBlock &other) = default;
+
+  // The storage was writable when the block was made.
+  double *Data() const noexcept {
+    return const_cast<double *>(S21MatrixView::Data());
+  }
+  S21MatrixBlock Block(int row, int col, int rows, int cols) const;
+  double &operator()(int i, int j) const;
+
+  // Elementwise operations; throw std::invalid_argument on a shape mismatch.
+  // A source that overlaps the block out of place is evaluated first.
+  S21MatrixBlock &operator=(const S21MatrixBlock &other);
+  template <typename E>
+  S21MatrixBlock &operator=(const S21MatrixExpr<E> &expr);
+  template <typename E>
+  S21MatrixBlock &operator+=(const S21MatrixExpr<E> &expr);
+  template <typename E>
+  S21MatrixBlock &operator-=(const S21MatrixExpr<E> &expr);
+  S21MatrixBlock &operator*=(const double num);
+  // Replaces the block with block * other; other must be square with as
+  // many rows as the block has columns.
+  S21MatrixBlock &operator*=(const S21MatrixView &other);
+
+ private:
+  template <typename E, typename Func>
+  void EvalExpr(const E &expr, Func func) const;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MATRIX_VIEW_H_
@@ -0,0 +1,197 @@
+#include "s21_memory_resource.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+constexpr std::size_t kMinBlock = 64;
+
+thread_local std::pmr::memory_resource *current_resource = nullptr;
+
+S21NewDeleteResource &DefaultResource() {
+  // Never destroyed, so matrices with static storage can still free into it.
+  static S21NewDeleteResource *resource = new S21NewDeleteResource;
+  return *resource;
+}
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+void S21MemoryResource::CountAllocation(std::size_t bytes) noexcept {
+  bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  blocks_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void S21MemoryResource::CountDeallocation(std::size_t bytes) noexcept {
+  bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+  blocks_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void *S21NewDeleteResource::do_allocate(std::size_t bytes,
+                                        std::size_t alignment) {
+  void *p = ::operator new(bytes, std::align_val_t(alignment));
+  CountAllocation(bytes);
+  return p;
+}
+
+void S21NewDeleteResource::do_deallocate(void *p, std::size_t bytes,
+                                         std::size_t alignment) {
+  ::operator delete(p, std::align_val_t(alignment));
+  CountDeallocation(bytes);
+}
+
+bool S21NewDeleteResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+S21PoolResource::S21PoolResource(std::size_t max_pooled,
+                                 std::pmr::memory_resource *upstream)
+    : max_pooled_(max_pooled), upstream_(upstream) {
+  free_lists_.assign(SizeClass(max_pooled_) + 1, nullptr);
+}
+
+S21PoolResource::~S21PoolResource() { Release(); }
+
+void S21PoolResource::Release() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (std::size_t cls = 0; cls < free_lists_.size(); cls++) {
+    while (free_lists_[cls] != nullptr) {
+      void *block = free_lists_[cls];
+      free_lists_[cls] = *static_cast<void **>(block);
+      upstream_->deallocate(block, kMinBlock << cls, kMinBlock);
+    }
+  }
+}
+
+void *S21PoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  void *p = nullptr;
+  if (bytes > max_pooled_ || alignment > kMinBlock) {
+    p = upstream_->allocate(bytes, alignment);
+  } else {
+    const int cls = SizeClass(bytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      p = free_lists_[cls];
+      if (p != nullptr) free_lists_[cls] = *static_cast<void **>(p);
+    }
+    if (p == nullptr) p = upstream_->allocate(kMinBlock << cls, kMinBlock);
+  }
+  CountAllocation(bytes);
+  return p;
+}
+
+void S21PoolResource::do_deallocate(void *p, std::size_t bytes,
+                                    std::size_t alignment) {
+  if (bytes > max_pooled_ || alignment > kMinBlock) {
+    upstream_->deallocate(p, bytes, alignment);
+  } else {
+    const int cls = SizeClass(bytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    *static_cast<void **>(p) = free_lists_[cls];
+    free_lists_[cls] = p;
+  }
+  CountDeallocation(bytes);
+}
+
+bool S21PoolResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+int S21PoolResource::SizeClass(std::size_t bytes) const noexcept {
+  int cls = 0;
+  while ((kMinBlock << cls) < bytes) cls++;
+  return cls;
+}
+
+S21ArenaResource::S21ArenaResource(std::size_t chunk_size,
+                                   std::pmr::memory_resource *upstream)
+    : chunk_size_(chunk_size), upstream_(upstream), current_(0), offset_(0) {}
+
+S21ArenaResource::~S21ArenaResource() {
+  for (const Chunk &chunk : chunks_) {
+    upstream_->deallocate(chunk.data, chunk.size, kMinBlock);
+  }
+}
+
+void S21ArenaResource::Reset() {
+  if (BlocksInUse() != 0) {
+    throw std::logic_error("Arena is reset while its blocks are in use");
+  }
+  current_ = 0;
+  offset_ = 0;
+}
+
+void *S21ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  while (current_ < chunks_.size()) {
+    const std::size_t start = AlignedOffset(chunks_[current_], alignment);
+    if (start + bytes <= chunks_[current_].size) {
+      offset_ = start + bytes;
+      CountAllocation(bytes);
+      return chunks_[current_].data + start;
+    }
+    current_++;
+    offset_ = 0;
+  }
+  const std::size_t size =
+      std::max(chunk_size_, AlignUp(bytes, kMinBlock) + alignment);
+  chunks_.push_back(
+      {static_cast<char *>(upstream_->allocate(size, kMinBlock)), size});
+  current_ = chunks_.size() - 1;
+  offset_ = 0;
+  const std::size_t start = AlignedOffset(chunks_[current_], alignment);
+  offset_ = start + bytes;
+  CountAllocation(bytes);
+  return chunks_[current_].data + start;
+}
+
+std::size_t S21ArenaResource::AlignedOffset(const Chunk &chunk,
+                                           std::size_t alignment) const {
+  const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.data);
+  return AlignUp(base + offset_, alignment) - base;
+}
+
+void S21ArenaResource::do_deallocate(void *, std::size_t bytes, std::size_t) {
+  CountDeallocation(bytes);
+}
+
+bool S21ArenaResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+S21MemoryResourceScope::S21MemoryResourceScope(
+    std::pmr::memory_resource *resource)
+    : previous_(S21Matrix::SetMemoryResource(resource)) {}
+
+S21MemoryResourceScope::~S21MemoryResourceScope() {
+  S21Matrix::SetMemoryResource(previous_);
+}
+
+std::pmr::memory_resource *S21CurrentMemoryResource() {
+  return current_resource != nullptr ? current_resource : &DefaultResource();
+}
+
+std::pmr::memory_resource *S21Matrix::GetMemoryResource() {
+  return S21CurrentMemoryResource();
+}
+
+std::pmr::memory_resource *S21Matrix::SetMemoryResource(
+    std::pmr::memory_resource *resource) {
+  std::pmr::memory_resource *previous = GetMemoryResource();
+  current_resource = resource;
+  return previous;
+}
+
+S21MemoryResource &S21Matrix::DefaultMemoryResource() {
+  return DefaultResource();
+}
@@ -0,0 +1,120 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MEMORY_RESOURCE_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MEMORY_RESOURCE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// std::pmr resource that counts the bytes and blocks it has handed out and
+// not yet taken back.
+class S21MemoryResource : public std::pmr::memory_resource {
+ public:
+  std::size_t BytesInUse() const noexcept { return bytes_.load(); }
+  std::size_t BlocksInUse() const noexcept { return blocks_.load(); }
+
+ protected:
+  void CountAllocation(std::size_t bytes) noexcept;
+  void CountDeallocation(std::size_t bytes) noexcept;
+
+ private:
+  std::atomic<std::size_t> bytes_{0};
+  std::atomic<std::size_t> blocks_{0};
+};
+
+// Aligned operator new/delete; the resource S21Matrix uses by default.
+class S21NewDeleteResource final : public S21MemoryResource {
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+};
+
+// Keeps freed blocks in power-of-two size classes and hands them out again
+// without touching the upstream resource. Requests above max_pooled bytes go
+// straight upstream. Thread-safe; must outlive every matrix it allocated.
+class S21PoolResource final : public S21MemoryResource {
+ public:
+  explicit S21PoolResource(
+      std::size_t max_pooled = std::size_t(1) << 22,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  S21PoolResource(const S21PoolResource &) = delete;
+  S21PoolResource &operator=(const S21PoolResource &) = delete;
+  ~S21PoolResource() override;
+
+  // Returns every cached free block to the upstream resource.
+  void Release();
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+  int SizeClass(std::size_t bytes) const noexcept;
+
+  std::size_t max_pooled_;
+  std::pmr::memory_resource *upstream_;
+  std::mutex mutex_;
+  std::vector<void *> free_lists_;
+};
+
+// Bump allocator over large chunks: deallocation only updates the counters,
+// Reset() makes the whole arena available again. Meant to be reset once per
+// request; not thread-safe.
+class S21ArenaResource final : public S21MemoryResource {
+ public:
+  explicit S21ArenaResource(
+      std::size_t chunk_size = std::size_t(1) << 20,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  S21ArenaResource(const S21ArenaResource &) = delete;
+  S21ArenaResource &operator=(const S21ArenaResource &) = delete;
+  ~S21ArenaResource() override;
+
+  // Rewinds the arena so its chunks are reused by the next allocations.
+  // Throws std::logic_error while blocks from the arena are still in use.
+  void Reset();
+
+ private:
+  struct Chunk {
+    char *data;
+    std::size_t size;
+  };
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+  std::size_t AlignedOffset(const Chunk &chunk, std::size_t alignment) const;
+
+  std::size_t chunk_size_;
+  std::pmr::memory_resource *upstream_;
+  std::vector<Chunk> chunks_;
+  std::size_t current_;
+  std::size_t offset_;
+};
+
+// Resource that matrices created by the calling thread allocate from, along
+// with the temporaries of their operations. The GEMM pack buffers are the
+// exception: they are per-thread, live as long as the thread and come from
+// operator new.
+std::pmr::memory_resource *S21CurrentMemoryResource();
+
+// Installs a resource for the matrices created by the calling thread and
+// restores the previous one on destruction.
+class S21MemoryResourceScope {
+ public:
+  explicit S21MemoryResourceScope(std::pmr::memory_resource *resource);
+  S21MemoryResourceScope(const S21MemoryResourceScope &) = delete;
+  S21MemoryResourceScope &operator=(const S21MemoryResourceScope &) = delete;
+  ~S21MemoryResourceScope();
+
+ private:
+  std::pmr::memory_resource *previous_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_MEMORY_RESOURCE_H_
@@ -0,0 +1,77 @@
+#include "s21_qr_factorization.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "s21_matrix_lu.h"
+#include "s21_matrix_qr.h"
+
+S21Matrix S21Matrix::LeastSquares(const S21MatrixView &a,
+                                  const S21MatrixView &b) {
+  return S21QrFactorization(a).Solve(b);
+}
+
+S21QrFactorization::S21QrFactorization(const S21MatrixView &matrix)
+    : qr_(matrix), full_rank_(true) {
+  const int m = qr_.rows_, n = qr_.cols_;
+  if (m < n) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  t_.resize(static_cast<std::size_t>(n) * s21::kQrBlock);
+  s21::QrFactor(qr_.matrix_, m, n, qr_.ld_, t_.data());
+  double scale = 0.0;
+  for (int i = 0; i < n; i++) {
+    for (int j = i; j < n; j++) scale = std::max(scale, fabs(qr_.Row(i)[j]));
+  }
+  for (int i = 0; i < n && full_rank_; i++) {
+    full_rank_ = fabs(qr_.Row(i)[i]) > S21Tolerance<double>::kValue * scale;
+  }
+}
+
+S21Matrix S21QrFactorization::GetQ() const {
+  S21Matrix res(GetRows(), GetCols());
+  for (int i = 0; i < GetCols(); i++) res.Row(i)[i] = 1.0;
+  s21::QrMultiply(qr_.matrix_, qr_.rows_, qr_.cols_, qr_.ld_, t_.data(),
+                  false, res.matrix_, res.cols_, res.ld_);
+  return res;
+}
+
+S21Matrix S21QrFactorization::GetR() const {
+  S21Matrix res(GetCols(), GetCols());
+  for (int i = 0; i < GetCols(); i++) {
+    std::copy(qr_.Row(i) + i, qr_.Row(i) + GetCols(), res.Row(i) + i);
+  }
+  return res;
+}
+
+S21Matrix S21QrFactorization::Solve(const S21MatrixView &b) const {
+  CheckSolve(b.GetRows());
+  S21Matrix res(b);
+  s21::QrMultiply(qr_.matrix_, qr_.rows_, qr_.cols_, qr_.ld_, t_.data(), true,
+                  res.matrix_, res.cols_, res.ld_);
+  s21::UpperSolve(qr_.matrix_, qr_.cols_, qr_.ld_, res.matrix_, res.cols_,
+                  res.ld_);
+  res.SetRows(GetCols());
+  return res;
+}
+
+std::vector<double> S21QrFactorization::Solve(
+    const std::vector<double> &b) const {
+  CheckSolve(static_cast<int>(b.size()));
+  std::vector<double> res(b);
+  s21::QrMultiply(qr_.matrix_, qr_.rows_, qr_.cols_, qr_.ld_, t_.data(), true,
+                  res.data(), 1, 1);
+  s21::UpperSolve(qr_.matrix_, qr_.cols_, qr_.ld_, res.data(), 1, 1);
+  res.resize(GetCols());
+  return res;
+}
+
+void S21QrFactorization::CheckSolve(int rows) const {
+  if (rows != GetRows()) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  } else if (!full_rank_) {
+    throw std::invalid_argument("Invalid argument! Matrix is rank deficient");
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_QR_FACTORIZATION_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_QR_FACTORIZATION_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// A = Q R of an m x n matrix with m >= n, by blocked Householder reflections.
+// Q is kept implicitly as the Householder vectors and one small T factor
+// per panel, so applying it costs two passes over the vectors. The least
+// squares solution of A x = b comes from R x = (Q^T b)(0:n) and, unlike the
+// normal equations, does not square the condition number of A.
+class S21QrFactorization {
+ public:
+  // Throws std::invalid_argument if matrix has more columns than rows.
+  explicit S21QrFactorization(const S21MatrixView &matrix);
+
+  int GetRows() const noexcept { return qr_.GetRows(); }
+  int GetCols() const noexcept { return qr_.GetCols(); }
+  // The m x n matrix of the first n columns of Q, and the n x n R.
+  S21Matrix GetQ() const;
+  S21Matrix GetR() const;
+
+  // X minimizing the 2-norm of every column of A * X - b. Throws
+  // std::invalid_argument unless b has GetRows() rows and A has full column
+  // rank.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  std::vector<double> Solve(const std::vector<double> &b) const;
+
+ private:
+  S21Matrix qr_;
+  std::vector<double> t_;
+  bool full_rank_;
+
+  void CheckSolve(int rows) const;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_QR_FACTORIZATION_H_
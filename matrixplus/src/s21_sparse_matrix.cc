@@ -0,0 +1,352 @@
+#include "s21_sparse_matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_thread_pool.h"
+
+S21SparseMatrix::S21SparseMatrix()
+    : rows_(0),
+      cols_(0),
+      format_(S21SparseFormat::kCsr),
+      pointers_(1, 0, S21CurrentMemoryResource()),
+      indices_(S21CurrentMemoryResource()),
+      values_(S21CurrentMemoryResource()) {}
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols, S21SparseFormat format)
+    : rows_(rows),
+      cols_(cols),
+      format_(format),
+      pointers_(S21CurrentMemoryResource()),
+      indices_(S21CurrentMemoryResource()),
+      values_(S21CurrentMemoryResource()) {
+  if (rows_ <= 0 || cols_ <= 0) throw std::out_of_range("Invalid matrix size");
+  pointers_.assign(static_cast<std::size_t>(Outer()) + 1, 0);
+}
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols,
+                                 const std::vector<S21Triplet> &triplets,
+                                 S21SparseFormat format)
+    : S21SparseMatrix(rows, cols, format) {
+  // Entries are sorted by (outer, inner) index, then runs of equal indices
+  // are summed into one element.
+  const bool csr = format_ == S21SparseFormat::kCsr;
+  std::pmr::vector<std::pair<std::pair<int, int>, double>> entries(
+      S21CurrentMemoryResource());
+  entries.reserve(triplets.size());
+  for (const S21Triplet &t : triplets) {
+    if (t.row < 0 || t.col < 0 || t.row >= rows_ || t.col >= cols_)
+      throw std::out_of_range("Index outside the matrix");
+    entries.push_back({csr ? std::make_pair(t.row, t.col)
+                           : std::make_pair(t.col, t.row),
+                       t.value});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+  indices_.reserve(entries.size());
+  values_.reserve(entries.size());
+  for (std::size_t p = 0; p < entries.size();) {
+    const std::pair<int, int> index = entries[p].first;
+    double sum = 0.0;
+    for (; p < entries.size() && entries[p].first == index; p++) {
+      sum += entries[p].second;
+    }
+    if (sum != 0.0) {
+      pointers_[index.first + 1]++;
+      indices_.push_back(index.second);
+      values_.push_back(sum);
+    }
+  }
+  for (int outer = 0; outer < Outer(); outer++) {
+    pointers_[outer + 1] += pointers_[outer];
+  }
+}
+
+S21SparseMatrix::S21SparseMatrix(const S21Matrix &dense,
+                                 S21SparseFormat format)
+    : S21SparseMatrix(dense.GetRows(), dense.GetCols(), format) {
+  const bool csr = format_ == S21SparseFormat::kCsr;
+  for (int outer = 0; outer < Outer(); outer++) {
+    for (int inner = 0; inner < Inner(); inner++) {
+      const double value = csr ? dense(outer, inner) : dense(inner, outer);
+      if (value != 0.0) {
+        indices_.push_back(inner);
+        values_.push_back(value);
+      }
+    }
+    pointers_[outer + 1] = values_.size();
+  }
+}
+
+S21SparseMatrix::S21SparseMatrix(const S21SparseMatrix &other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      format_(other.format_),
+      pointers_(other.pointers_, S21CurrentMemoryResource()),
+      indices_(other.indices_, S21CurrentMemoryResource()),
+      values_(other.values_, S21CurrentMemoryResource()) {}
+
+S21SparseMatrix::S21SparseMatrix(S21SparseMatrix &&other) noexcept
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      format_(other.format_),
+      pointers_(std::move(other.pointers_)),
+      indices_(std::move(other.indices_)),
+      values_(std::move(other.values_)) {
+  other.rows_ = 0;
+  other.cols_ = 0;
+  other.pointers_.assign(1, 0);
+  other.indices_.clear();
+  other.values_.clear();
+}
+
+bool S21SparseMatrix::EqMatrix(const S21SparseMatrix &other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  if (rows_ == 0) return true;
+  S21SparseMatrix diff(*this);
+  diff.SubMatrix(other);
+  return std::all_of(diff.values_.begin(), diff.values_.end(),
+                     [](double value) {
+                       return std::fabs(value) <= S21Tolerance<double>::kValue;
+                     });
+}
+
+void S21SparseMatrix::SumMatrix(const S21SparseMatrix &other) {
+  Merge(other, 1.0);
+}
+
+void S21SparseMatrix::SubMatrix(const S21SparseMatrix &other) {
+  Merge(other, -1.0);
+}
+
+void S21SparseMatrix::Merge(const S21SparseMatrix &other, double sign) {
+  if (rows_ != other.rows_ || cols_ != other.cols_ || rows_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  if (other.format_ != format_) {
+    Merge(other.ToFormat(format_), sign);
+    return;
+  }
+  // Both index lists of an outer slice are sorted, so they are merged in one
+  // pass; exact cancellations are dropped.
+  S21SparseMatrix res(rows_, cols_, format_);
+  res.indices_.reserve(values_.size() + other.values_.size());
+  res.values_.reserve(values_.size() + other.values_.size());
+  auto push = [&res](int index, double value) {
+    if (value != 0.0) {
+      res.indices_.push_back(index);
+      res.values_.push_back(value);
+    }
+  };
+  for (int outer = 0; outer < Outer(); outer++) {
+    std::size_t p = pointers_[outer], q = other.pointers_[outer];
+    const std::size_t p_end = pointers_[outer + 1];
+    const std::size_t q_end = other.pointers_[outer + 1];
+    while (p < p_end || q < q_end) {
+      if (q == q_end || (p < p_end && indices_[p] < other.indices_[q])) {
+        push(indices_[p], values_[p]);
+        p++;
+      } else if (p == p_end || other.indices_[q] < indices_[p]) {
+        push(other.indices_[q], sign * other.values_[q]);
+        q++;
+      } else {
+        push(indices_[p], values_[p] + sign * other.values_[q]);
+        p++;
+        q++;
+      }
+    }
+    res.pointers_[outer + 1] = res.values_.size();
+  }
+  *this = std::move(res);
+}
+
+void S21SparseMatrix::MulNumber(const double num) {
+  if (num == 0.0) {
+    std::fill(pointers_.begin(), pointers_.end(), 0);
+    indices_.clear();
+    values_.clear();
+    return;
+  }
+  for (double &value : values_) value *= num;
+}
+
+S21Matrix S21SparseMatrix::MulMatrix(const S21MatrixView &other) const {
+  if (cols_ != other.GetRows() || rows_ == 0 || other.GetCols() == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21Matrix res(rows_, other.GetCols());
+  const int n = other.GetCols();
+  const std::ptrdiff_t rs = other.GetRowStride(), cs = other.GetColStride();
+  // Row i of the result gathers a(i, k) * other row k over the stored k.
+  auto axpy = [&](double *dst, double a, int k) {
+    const double *src = other.Data() + k * rs;
+    if (cs == 1) {
+      for (int j = 0; j < n; j++) dst[j] += a * src[j];
+    } else {
+      for (int j = 0; j < n; j++) dst[j] += a * src[j * cs];
+    }
+  };
+  if (format_ == S21SparseFormat::kCsr) {
+    const long work = static_cast<long>(values_.size()) * n;
+    s21::ParallelFor(rows_, work, [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        double *dst = &res(i, 0);
+        for (std::size_t p = pointers_[i]; p < pointers_[i + 1]; p++) {
+          axpy(dst, values_[p], indices_[p]);
+        }
+      }
+    });
+  } else {
+    for (int k = 0; k < cols_; k++) {
+      for (std::size_t p = pointers_[k]; p < pointers_[k + 1]; p++) {
+        axpy(&res(indices_[p], 0), values_[p], k);
+      }
+    }
+  }
+  return res;
+}
+
+std::vector<double> S21SparseMatrix::MulVector(
+    const std::vector<double> &x) const {
+  if (x.size() != static_cast<std::size_t>(cols_) || rows_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  std::vector<double> y(rows_);
+  if (format_ == S21SparseFormat::kCsr) {
+    // One pass over the arrays with a dot product per row: bound by memory
+    // bandwidth, and rows are independent.
+    const long work = static_cast<long>(values_.size()) + rows_;
+    s21::ParallelFor(rows_, work, [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        double sum = 0.0;
+        for (std::size_t p = pointers_[i]; p < pointers_[i + 1]; p++) {
+          sum += values_[p] * x[indices_[p]];
+        }
+        y[i] = sum;
+      }
+    });
+  } else {
+    // Columns scatter into y, so this stays on one thread.
+    for (int j = 0; j < cols_; j++) {
+      const double xj = x[j];
+      for (std::size_t p = pointers_[j]; p < pointers_[j + 1]; p++) {
+        y[indices_[p]] += values_[p] * xj;
+      }
+    }
+  }
+  return y;
+}
+
+S21SparseMatrix S21SparseMatrix::ToFormat(S21SparseFormat format) const {
+  if (format == format_ || rows_ == 0) {
+    S21SparseMatrix res(*this);
+    res.format_ = format;
+    return res;
+  }
+  // Counting sort on the inner index: walking the outer slices in order
+  // leaves every new slice sorted.
+  S21SparseMatrix res(rows_, cols_, format);
+  res.indices_.resize(values_.size());
+  res.values_.resize(values_.size());
+  for (int index : indices_) res.pointers_[index + 1]++;
+  for (int inner = 0; inner < Inner(); inner++) {
+    res.pointers_[inner + 1] += res.pointers_[inner];
+  }
+  std::vector<std::size_t> next(res.pointers_.begin(), res.pointers_.end() - 1);
+  for (int outer = 0; outer < Outer(); outer++) {
+    for (std::size_t p = pointers_[outer]; p < pointers_[outer + 1]; p++) {
+      const std::size_t dst = next[indices_[p]]++;
+      res.indices_[dst] = outer;
+      res.values_[dst] = values_[p];
+    }
+  }
+  return res;
+}
+
+S21SparseMatrix S21SparseMatrix::Transpose() const {
+  S21SparseMatrix res(*this);
+  std::swap(res.rows_, res.cols_);
+  res.format_ = format_ == S21SparseFormat::kCsr ? S21SparseFormat::kCsc
+                                                 : S21SparseFormat::kCsr;
+  return res;
+}
+
+S21Matrix S21SparseMatrix::ToDense() const {
+  S21Matrix res(rows_, cols_);
+  const bool csr = format_ == S21SparseFormat::kCsr;
+  for (int outer = 0; outer < Outer(); outer++) {
+    for (std::size_t p = pointers_[outer]; p < pointers_[outer + 1]; p++) {
+      if (csr) {
+        res(outer, indices_[p]) = values_[p];
+      } else {
+        res(indices_[p], outer) = values_[p];
+      }
+    }
+  }
+  return res;
+}
+
+S21SparseMatrix &S21SparseMatrix::operator=(const S21SparseMatrix &other) {
+  if (this != &other) {
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    format_ = other.format_;
+    pointers_ = other.pointers_;
+    indices_ = other.indices_;
+    values_ = other.values_;
+  }
+  return *this;
+}
+
+S21SparseMatrix &S21SparseMatrix::operator=(S21SparseMatrix &&other) {
+  if (this != &other) {
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    format_ = other.format_;
+    pointers_ = std::move(other.pointers_);
+    indices_ = std::move(other.indices_);
+    values_ = std::move(other.values_);
+    other.rows_ = 0;
+    other.cols_ = 0;
+    other.pointers_.assign(1, 0);
+    other.indices_.clear();
+    other.values_.clear();
+  }
+  return *this;
+}
+
+bool S21SparseMatrix::operator==(const S21SparseMatrix &other) const {
+  return EqMatrix(other);
+}
+
+S21SparseMatrix &S21SparseMatrix::operator+=(const S21SparseMatrix &other) {
+  SumMatrix(other);
+  return *this;
+}
+
+S21SparseMatrix &S21SparseMatrix::operator-=(const S21SparseMatrix &other) {
+  SubMatrix(other);
+  return *this;
+}
+
+S21SparseMatrix &S21SparseMatrix::operator*=(const double num) {
+  MulNumber(num);
+  return *this;
+}
+
+double S21SparseMatrix::operator()(int i, int j) const {
+  if (i < 0 || j < 0 || i >= rows_ || j >= cols_)
+    throw std::out_of_range("Index outside the matrix");
+  const bool csr = format_ == S21SparseFormat::kCsr;
+  const int outer = csr ? i : j, inner = csr ? j : i;
+  const int *begin = indices_.data() + pointers_[outer];
+  const int *end = indices_.data() + pointers_[outer + 1];
+  const int *found = std::lower_bound(begin, end, inner);
+  return found != end && *found == inner ? values_[found - indices_.data()]
+                                         : 0.0;
+}
@@ -0,0 +1,121 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SPARSE_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SPARSE_MATRIX_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// kCsr compresses rows: Pointers()[i] to Pointers()[i + 1] index the column
+// numbers and values of row i. kCsc is the same with the roles of rows and
+// columns exchanged.
+enum class S21SparseFormat { kCsr, kCsc };
+
+struct S21Triplet {
+  int row, col;
+  double value;
+};
+
+// Compressed sparse matrix. Only non-zero elements are stored, sorted by
+// their index inside every row (CSR) or column (CSC); arithmetic drops the
+// zeros it produces. Storage comes from the current S21Matrix memory
+// resource. Operands of different formats are accepted everywhere, the
+// result takes the format of the left one.
+class S21SparseMatrix {
+ public:
+  S21SparseMatrix();
+  // rows x cols matrix of zeros.
+  S21SparseMatrix(int rows, int cols,
+                  S21SparseFormat format = S21SparseFormat::kCsr);
+  // Duplicate triplets are summed. Throws std::out_of_range for a triplet
+  // outside the matrix.
+  S21SparseMatrix(int rows, int cols, const std::vector<S21Triplet> &triplets,
+                  S21SparseFormat format = S21SparseFormat::kCsr);
+  explicit S21SparseMatrix(const S21Matrix &dense,
+                           S21SparseFormat format = S21SparseFormat::kCsr);
+  S21SparseMatrix(const S21SparseMatrix &other);
+  S21SparseMatrix(S21SparseMatrix &&other) noexcept;
+  ~S21SparseMatrix() = default;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  S21SparseFormat GetFormat() const noexcept { return format_; }
+  std::size_t NonZeros() const noexcept { return values_.size(); }
+  // The compressed arrays, for handing the matrix to other code.
+  const std::size_t *Pointers() const noexcept { return pointers_.data(); }
+  const int *Indices() const noexcept { return indices_.data(); }
+  const double *Values() const noexcept { return values_.data(); }
+
+  bool EqMatrix(const S21SparseMatrix &other) const;
+  void SumMatrix(const S21SparseMatrix &other);
+  void SubMatrix(const S21SparseMatrix &other);
+  void MulNumber(const double num);
+  // this * other; other may be any dense matrix or view.
+  S21Matrix MulMatrix(const S21MatrixView &other) const;
+  // this * x, x having GetCols() elements.
+  std::vector<double> MulVector(const std::vector<double> &x) const;
+  // The same matrix in the other format, in O(NonZeros() + GetRows() +
+  // GetCols()).
+  S21SparseMatrix ToFormat(S21SparseFormat format) const;
+  // Reinterprets the compressed arrays: CSR of a matrix is CSC of its
+  // transpose, so the arrays are copied unchanged, with no sort.
+  S21SparseMatrix Transpose() const;
+  S21Matrix ToDense() const;
+
+  S21SparseMatrix &operator=(const S21SparseMatrix &other);
+  S21SparseMatrix &operator=(S21SparseMatrix &&other);
+  bool operator==(const S21SparseMatrix &other) const;
+  S21SparseMatrix &operator+=(const S21SparseMatrix &other);
+  S21SparseMatrix &operator-=(const S21SparseMatrix &other);
+  S21SparseMatrix &operator*=(const double num);
+  double operator()(int i, int j) const;
+
+  friend S21SparseMatrix operator+(S21SparseMatrix lhs,
+                                   const S21SparseMatrix &rhs) {
+    return lhs += rhs;
+  }
+
+  friend S21SparseMatrix operator-(S21SparseMatrix lhs,
+                                   const S21SparseMatrix &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend S21SparseMatrix operator*(S21SparseMatrix matrix,
+                                   const double num) {
+    return matrix *= num;
+  }
+
+  friend S21SparseMatrix operator*(const double num,
+                                   S21SparseMatrix matrix) {
+    return matrix *= num;
+  }
+
+  friend S21Matrix operator*(const S21SparseMatrix &lhs,
+                             const S21MatrixView &rhs) {
+    return lhs.MulMatrix(rhs);
+  }
+
+  friend std::vector<double> operator*(const S21SparseMatrix &lhs,
+                                       const std::vector<double> &rhs) {
+    return lhs.MulVector(rhs);
+  }
+
+ private:
+  int rows_, cols_;
+  S21SparseFormat format_;
+  std::pmr::vector<std::size_t> pointers_;
+  std::pmr::vector<int> indices_;
+  std::pmr::vector<double> values_;
+
+  // Rows for CSR, columns for CSC, and the other extent.
+  int Outer() const noexcept {
+    return format_ == S21SparseFormat::kCsr ? rows_ : cols_;
+  }
+  int Inner() const noexcept {
+    return format_ == S21SparseFormat::kCsr ? cols_ : rows_;
+  }
+  void Merge(const S21SparseMatrix &other, double sign);
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SPARSE_MATRIX_H_
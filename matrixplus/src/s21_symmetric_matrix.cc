@@ -0,0 +1,208 @@
+#include "s21_symmetric_matrix.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_simd.h"
+
+namespace {
+
+// Rows of the result computed per GEMM call. Only the diagonal tile of each
+// strip is computed in full, so the flop count is about
+// (1 + kSyrkStrip / n) / 2 of the full product's.
+constexpr int kSyrkStrip = 64;
+
+S21MatrixView SyrkOperand(S21Transpose trans, const S21MatrixView &a) {
+  return trans == S21Transpose::kTranspose ? a.Transpose() : a;
+}
+
+// Rows begin to begin + rows of alpha * a * a^T, columns 0 to begin + rows,
+// into c with beta applied.
+void SyrkStrip(const S21MatrixView &a, int begin, int rows, double alpha,
+               double beta, double *c, std::ptrdiff_t ldc) {
+  const std::ptrdiff_t rs = a.GetRowStride(), cs = a.GetColStride();
+  s21::Gemm(rows, begin + rows, a.GetCols(), alpha, a.Data() + begin * rs, rs,
+            cs, a.Data(), cs, rs, beta, c, ldc);
+}
+
+}  // namespace
+
+void S21Matrix::Syrk(S21Transpose trans, double alpha, const S21MatrixView &a,
+                     double beta, S21Matrix &c) {
+  S21MatrixView op_a = SyrkOperand(trans, a);
+  const int n = op_a.GetRows();
+  const bool resize = c.rows_ != n || c.cols_ != n;
+  if (n == 0 || op_a.GetCols() == 0 || (resize && beta != 0.0)) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  S21Matrix a_copy;
+  if (op_a.Overlaps(c)) {
+    a_copy = op_a;
+    op_a = a_copy;
+  }
+  if (resize) c = Uninitialized(n, n);
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int begin = 0; begin < n; begin += kSyrkStrip) {
+    const int rows = std::min(kSyrkStrip, n - begin);
+    SyrkStrip(op_a, begin, rows, alpha, beta, c.Row(begin), c.ld_);
+    // The strip left of its diagonal tile becomes the column block above
+    // it; inside the tile the lower half is mirrored.
+    simd.transpose(c.Row(begin), c.ld_, c.matrix_ + begin, c.ld_, begin,
+                   rows);
+    for (int i = 0; i < rows; i++) {
+      for (int j = i + 1; j < rows; j++) {
+        c.Row(begin + i)[begin + j] = c.Row(begin + j)[begin + i];
+      }
+    }
+  }
+}
+
+S21SymmetricMatrix::S21SymmetricMatrix()
+    : size_(0), packed_(S21CurrentMemoryResource()) {}
+
+S21SymmetricMatrix::S21SymmetricMatrix(int size)
+    : size_(size), packed_(S21CurrentMemoryResource()) {
+  if (size_ <= 0) throw std::out_of_range("Invalid matrix size");
+  packed_.resize(static_cast<std::size_t>(size_) * (size_ + 1) / 2);
+}
+
+S21SymmetricMatrix::S21SymmetricMatrix(const S21Matrix &other)
+    : size_(other.GetRows()), packed_(S21CurrentMemoryResource()) {
+  if (other.GetRows() != other.GetCols() || size_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  packed_.resize(static_cast<std::size_t>(size_) * (size_ + 1) / 2);
+  // As in S21CholeskyFactorization, the mismatch allowed between a_ij and
+  // a_ji grows with the entries.
+  double scale = 0.0;
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j < size_; j++) scale = std::max(scale, fabs(other(i, j)));
+  }
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j <= i; j++) {
+      if (fabs(other(i, j) - other(j, i)) >
+          S21Tolerance<double>::kValue * scale) {
+        throw std::invalid_argument(
+            "Invalid argument! Matrix is not symmetric");
+      }
+      Row(i)[j] = other(i, j);
+    }
+  }
+}
+
+S21SymmetricMatrix::S21SymmetricMatrix(const S21SymmetricMatrix &other)
+    : size_(other.size_), packed_(other.packed_, S21CurrentMemoryResource()) {}
+
+S21SymmetricMatrix::S21SymmetricMatrix(S21SymmetricMatrix &&other) noexcept
+    : size_(other.size_), packed_(std::move(other.packed_)) {
+  other.size_ = 0;
+  other.packed_.clear();
+}
+
+bool S21SymmetricMatrix::EqMatrix(
+    const S21SymmetricMatrix &other) const noexcept {
+  if (size_ != other.size_) return false;
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int i = 0; i < size_; i++) {
+    if (!simd.equal(Row(i), other.Row(i), i + 1,
+                    S21Tolerance<double>::kValue)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+S21Matrix S21SymmetricMatrix::ToMatrix() const {
+  S21Matrix res(size_, size_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j <= i; j++) {
+      res(i, j) = Row(i)[j];
+      res(j, i) = Row(i)[j];
+    }
+  }
+  return res;
+}
+
+void S21SymmetricMatrix::Syrk(S21Transpose trans, double alpha,
+                              const S21MatrixView &a, double beta) {
+  const S21MatrixView op_a = SyrkOperand(trans, a);
+  const int n = op_a.GetRows();
+  if (n == 0 || op_a.GetCols() == 0 || (size_ != n && beta != 0.0)) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+  if (size_ != n) *this = S21SymmetricMatrix(n);
+  std::pmr::vector<double> strip(static_cast<std::size_t>(kSyrkStrip) * n,
+                                 S21CurrentMemoryResource());
+  for (int begin = 0; begin < n; begin += kSyrkStrip) {
+    const int rows = std::min(kSyrkStrip, n - begin);
+    SyrkStrip(op_a, begin, rows, alpha, 0.0, strip.data(), n);
+    for (int i = 0; i < rows; i++) {
+      const double *src = strip.data() + static_cast<std::ptrdiff_t>(i) * n;
+      double *dst = Row(begin + i);
+      for (int j = 0; j <= begin + i; j++) {
+        dst[j] = beta == 0.0 ? src[j] : beta * dst[j] + src[j];
+      }
+    }
+  }
+}
+
+S21SymmetricMatrix &S21SymmetricMatrix::operator=(
+    S21SymmetricMatrix &&other) {
+  if (this != &other) {
+    size_ = other.size_;
+    packed_ = std::move(other.packed_);
+    other.size_ = 0;
+    other.packed_.clear();
+  }
+  return *this;
+}
+
+bool S21SymmetricMatrix::operator==(const S21SymmetricMatrix &other) const {
+  return EqMatrix(other);
+}
+
+S21SymmetricMatrix &S21SymmetricMatrix::operator+=(
+    const S21SymmetricMatrix &other) {
+  CheckSize(other);
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int i = 0; i < size_; i++) simd.add(Row(i), other.Row(i), i + 1);
+  return *this;
+}
+
+S21SymmetricMatrix &S21SymmetricMatrix::operator-=(
+    const S21SymmetricMatrix &other) {
+  CheckSize(other);
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int i = 0; i < size_; i++) simd.sub(Row(i), other.Row(i), i + 1);
+  return *this;
+}
+
+S21SymmetricMatrix &S21SymmetricMatrix::operator*=(const double num) {
+  const s21::SimdKernels &simd = s21::Simd();
+  for (int i = 0; i < size_; i++) simd.scale(Row(i), num, i + 1);
+  return *this;
+}
+
+double &S21SymmetricMatrix::operator()(int i, int j) {
+  if (i < 0 || j < 0 || i >= size_ || j >= size_)
+    throw std::out_of_range("Index outside the matrix");
+  return i >= j ? Row(i)[j] : Row(j)[i];
+}
+
+double S21SymmetricMatrix::operator()(int i, int j) const {
+  if (i < 0 || j < 0 || i >= size_ || j >= size_)
+    throw std::out_of_range("Index outside the matrix");
+  return i >= j ? Row(i)[j] : Row(j)[i];
+}
+
+void S21SymmetricMatrix::CheckSize(const S21SymmetricMatrix &other) const {
+  if (size_ != other.size_ || size_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument! Different matrix dimensions");
+  }
+}
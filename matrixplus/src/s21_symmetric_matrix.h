@@ -0,0 +1,82 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SYMMETRIC_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SYMMETRIC_MATRIX_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Symmetric n x n matrix that stores only its lower triangle, row by row, in
+// n * (n + 1) / 2 doubles: about half the memory of an S21Matrix, for Gram and
+// covariance matrices. (i, j) and (j, i) refer to the same element. Storage
+// comes from the current S21Matrix memory resource.
+class S21SymmetricMatrix {
+ public:
+  S21SymmetricMatrix();
+  explicit S21SymmetricMatrix(int size);
+  // Throws std::invalid_argument unless other is square and symmetric up to
+  // the S21Matrix tolerance times its largest entry; the lower triangle is
+  // kept.
+  explicit S21SymmetricMatrix(const S21Matrix &other);
+  S21SymmetricMatrix(const S21SymmetricMatrix &other);
+  S21SymmetricMatrix(S21SymmetricMatrix &&other) noexcept;
+  ~S21SymmetricMatrix() = default;
+
+  int GetSize() const noexcept { return size_; }
+  int GetRows() const noexcept { return size_; }
+  int GetCols() const noexcept { return size_; }
+
+  bool EqMatrix(const S21SymmetricMatrix &other) const noexcept;
+  // Full matrix with both triangles filled in.
+  S21Matrix ToMatrix() const;
+  // this = alpha * op(a) * op(a)^T + beta * this, as S21Matrix::Syrk, built
+  // one strip of rows at a time so no full-size temporary is needed. With
+  // beta 0 the previous contents are ignored and the size is adjusted.
+  void Syrk(S21Transpose trans, double alpha, const S21MatrixView &a,
+            double beta);
+
+  S21SymmetricMatrix &operator=(const S21SymmetricMatrix &other) = default;
+  S21SymmetricMatrix &operator=(S21SymmetricMatrix &&other);
+  bool operator==(const S21SymmetricMatrix &other) const;
+  S21SymmetricMatrix &operator+=(const S21SymmetricMatrix &other);
+  S21SymmetricMatrix &operator-=(const S21SymmetricMatrix &other);
+  S21SymmetricMatrix &operator*=(const double num);
+  double &operator()(int i, int j);
+  double operator()(int i, int j) const;
+
+  friend S21SymmetricMatrix operator+(S21SymmetricMatrix lhs,
+                                      const S21SymmetricMatrix &rhs) {
+    return lhs += rhs;
+  }
+
+  friend S21SymmetricMatrix operator-(S21SymmetricMatrix lhs,
+                                      const S21SymmetricMatrix &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend S21SymmetricMatrix operator*(S21SymmetricMatrix matrix,
+                                      const double num) {
+    return matrix *= num;
+  }
+
+  friend S21SymmetricMatrix operator*(const double num,
+                                      S21SymmetricMatrix matrix) {
+    return matrix *= num;
+  }
+
+ private:
+  int size_;
+  std::pmr::vector<double> packed_;
+
+  // Row i of the lower triangle, elements 0 to i.
+  double *Row(int i) noexcept {
+    return packed_.data() + static_cast<std::ptrdiff_t>(i) * (i + 1) / 2;
+  }
+  const double *Row(int i) const noexcept {
+    return packed_.data() + static_cast<std::ptrdiff_t>(i) * (i + 1) / 2;
+  }
+  void CheckSize(const S21SymmetricMatrix &other) const;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_SYMMETRIC_MATRIX_H_
@@ -0,0 +1,145 @@
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+thread_local bool in_worker = false;
+
+int DefaultThreadCount() {
+  const char *env = std::getenv("S21_MATRIX_THREADS");
+  if (env != nullptr) {
+    const int threads = std::atoi(env);
+    if (threads > 0) return threads;
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+namespace s21 {
+
+ThreadPool &ThreadPool::Instance() {
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::ThreadPool() : threads_(DefaultThreadCount()), generation_(0) {}
+
+ThreadPool::~ThreadPool() { Stop(); }
+
+int ThreadPool::GetThreadCount() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return threads_;
+}
+
+void ThreadPool::SetThreadCount(int threads) {
+  if (threads < 1) {
+    throw std::invalid_argument(
+        "Invalid argument! Thread count must be positive");
+  }
+  Stop();
+  std::lock_guard<std::mutex> lock(mutex_);
+  threads_ = threads;
+}
+
+void ThreadPool::ParallelFor(int count,
+                             const std::function<void(int, int)> &fn) {
+  const int parts = in_worker ? 1 : std::min(count, GetThreadCount());
+  if (parts <= 1) {
+    if (count > 0) fn(0, count);
+    return;
+  }
+
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  int pending = parts - 1;
+  std::exception_ptr error;
+  auto run = [&](int part) {
+    try {
+      fn(static_cast<long>(count) * part / parts,
+         static_cast<long>(count) * (part + 1) / parts);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(done_mutex);
+      if (!error) error = std::current_exception();
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (workers_.empty()) Start();
+    for (int part = 1; part < parts; part++) {
+      tasks_.emplace_back([&, part] {
+        run(part);
+        std::lock_guard<std::mutex> done_lock(done_mutex);
+        if (--pending == 0) done_cv.notify_one();
+      });
+    }
+  }
+  cv_.notify_all();
+  run(0);
+
+  std::unique_lock<std::mutex> lock(done_mutex);
+  done_cv.wait(lock, [&] { return pending == 0; });
+  if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::Start() {
+  for (int i = 1; i < threads_; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, generation_);
+  }
+}
+
+void ThreadPool::Stop() {
+  std::vector<std::thread> workers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    workers.swap(workers_);
+  }
+  cv_.notify_all();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::WorkerLoop(int generation) {
+  in_worker = true;
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this, generation] {
+        return generation != generation_ || !tasks_.empty();
+      });
+      if (tasks_.empty()) return;
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+void ParallelFor(int count, long work,
+                 const std::function<void(int, int)> &fn) {
+  if (work < kMinParallelWork) {
+    if (count > 0) fn(0, count);
+  } else {
+    ThreadPool::Instance().ParallelFor(count, fn);
+  }
+}
+
+}  // namespace s21
+
+int S21Matrix::GetThreadCount() {
+  return s21::ThreadPool::Instance().GetThreadCount();
+}
+
+void S21Matrix::SetThreadCount(const int threads) {
+  s21::ThreadPool::Instance().SetThreadCount(threads);
+}
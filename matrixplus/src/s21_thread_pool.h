@@ -0,0 +1,51 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_THREAD_POOL_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Process-wide pool shared by all matrix kernels. Workers are started on the
+// first parallel call; the calling thread always runs one share itself.
+class ThreadPool {
+ public:
+  static ThreadPool &Instance();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  int GetThreadCount();
+  void SetThreadCount(int threads);
+
+  // Calls fn(begin, end) on disjoint chunks covering [0, count) and waits for
+  // all of them. Calls made from inside a worker run inline.
+  void ParallelFor(int count, const std::function<void(int, int)> &fn);
+
+ private:
+  ThreadPool();
+  void Start();
+  void Stop();
+  void WorkerLoop(int generation);
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> tasks_;
+  std::vector<std::thread> workers_;
+  int threads_;
+  int generation_;
+};
+
+// Runs fn over [0, count) on the shared pool when the job performs at least
+// kMinParallelWork element operations, and inline otherwise.
+constexpr long kMinParallelWork = 1L << 16;
+void ParallelFor(int count, long work, const std::function<void(int, int)> &fn);
+
+}  // namespace s21
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_S21_THREAD_POOL_H_